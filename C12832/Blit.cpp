@@ -0,0 +1,242 @@
+/* 1bpp bit block transfer for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ */
+
+// 16.10.26    initial design
+
+#include "Blit.h"
+#include "stdint.h"
+#include "stddef.h"
+
+// raster operation on 8 pixel, only the bits in m are changed
+
+template <int ROP> static inline unsigned char rop_apply(unsigned char d, unsigned char s, unsigned char m)
+{
+    unsigned char r;
+    if(ROP == BLT_COPY) r = s;
+    else if(ROP == BLT_OR) r = d | s;
+    else if(ROP == BLT_AND) r = d & s;
+    else if(ROP == BLT_XOR) r = d ^ s;
+    else r = ~s;
+    return (d & ~m) | (r & m);
+}
+
+int blit_clip(int x0, int y0, int x1, int y1, int sw, int sh, int& dx, int& dy, int& sx, int& sy, int& w, int& h)
+{
+    if(sx < 0) {
+        w += sx;
+        dx -= sx;
+        sx = 0;
+    }
+    if(sy < 0) {
+        h += sy;
+        dy -= sy;
+        sy = 0;
+    }
+    if(dx < x0) {
+        w -= x0 - dx;
+        sx += x0 - dx;
+        dx = x0;
+    }
+    if(dy < y0) {
+        h -= y0 - dy;
+        sy += y0 - dy;
+        dy = y0;
+    }
+    if(sx + w > sw) w = sw - sx;
+    if(sy + h > sh) h = sh - sy;
+    if(dx + w - 1 > x1) w = x1 - dx + 1;
+    if(dy + h - 1 > y1) h = y1 - dy + 1;
+    return w > 0 && h > 0;
+}
+
+// mask of the rows of page p inside dy .. dy + h - 1
+
+static inline unsigned char page_mask(int p, int dy, int h)
+{
+    unsigned char m = 0xFF;
+    if(p == (dy >> 3)) m &= 0xFF << (dy & 7);
+    if(p == ((dy + h - 1) >> 3)) m &= 0xFF >> (7 - ((dy + h - 1) & 7));
+    return m;
+}
+
+// page source
+// the destination page p holds the source rows from row0 on,
+// they are in source page q (moved up by s) and q + 1 (moved down by 8 - s)
+
+template <int ROP> static void blit_pages(const PageBitmap& dst, int dx, int dy, const PageBitmap& src, int sx, int sy, int w, int h)
+{
+    int k, p, p0, p1, row0, q, s, i, j, pages, up, back;
+    const unsigned char* a;
+    const unsigned char* b;
+    unsigned char* d;
+    unsigned char m, v;
+
+    pages = (src.height + 7) >> 3;
+    p0 = dy >> 3;
+    p1 = (dy + h - 1) >> 3;
+    up = (src.data == dst.data && dy > sy);     // same bitmap : bottom up
+    back = (src.data == dst.data && dx > sx);   // same bitmap : right to left
+
+    for(k = 0; k <= p1 - p0; k++) {
+        p = up ? p1 - k : p0 + k;
+        m = page_mask(p, dy, h);
+        row0 = 8 * p - dy + sy;                 // >= -7
+        q = (row0 + 8) / 8 - 1;
+        s = row0 - 8 * q;
+        a = (q >= 0 && q < pages) ? &src.data[q * src.width + sx] : NULL;
+        b = (s != 0 && q + 1 < pages) ? &src.data[(q + 1) * src.width + sx] : NULL;
+        d = &dst.data[p * dst.width + dx];
+        for(j = 0; j < w; j++) {
+            i = back ? w - 1 - j : j;
+            v = 0;
+            if(a) v = a[i] >> s;
+            if(b) v |= b[i] << (8 - s);
+            d[i] = rop_apply<ROP>(d[i], v, m);
+        }
+    }
+}
+
+// 8x8 bit matrix (Hacker's Delight, transpose8)
+// a holds in[0..3], b in[4..7], the blocks are swapped along the diagonal
+
+void transpose8(const unsigned char* in, int stride, unsigned char* out)
+{
+    uint32_t a, b, t;
+
+    a = in[0] | (in[stride] << 8) | (in[2 * stride] << 16) | ((uint32_t)in[3 * stride] << 24);
+    b = in[4 * stride] | (in[5 * stride] << 8) | (in[6 * stride] << 16) | ((uint32_t)in[7 * stride] << 24);
+    t = (a ^ (a >> 7)) & 0x00AA00AAUL;        // 2x2 blocks
+    a ^= t ^ (t << 7);
+    t = (b ^ (b >> 7)) & 0x00AA00AAUL;
+    b ^= t ^ (t << 7);
+    t = (a ^ (a >> 14)) & 0x0000CCCCUL;       // 4x4 blocks
+    a ^= t ^ (t << 14);
+    t = (b ^ (b >> 14)) & 0x0000CCCCUL;
+    b ^= t ^ (t << 14);
+    t = (a ^ (b << 4)) & 0xF0F0F0F0UL;        // 8x8
+    a ^= t;
+    b ^= t >> 4;
+    out[0] = a;
+    out[1] = a >> 8;
+    out[2] = a >> 16;
+    out[3] = a >> 24;
+    out[4] = b;
+    out[5] = b >> 8;
+    out[6] = b >> 16;
+    out[7] = b >> 24;
+}
+
+// row source
+// for each destination page the 8 source rows are cut into
+// 8x8 blocks and transposed, rows outside the bitmap read as 0.
+// Bit 7 is the left pixel of a row, so column j of a block is c[7 - j].
+
+template <int ROP> static void blit_rows(const PageBitmap& dst, int dx, int dy, const Bitmap& src, int sx, int sy, int w, int h)
+{
+    int p, p0, p1, row0, r, k, X, X0, X1, j, j0, j1;
+    const unsigned char* rows[8];
+    unsigned char z[8];
+    unsigned char c[8];
+    unsigned char* d;
+    unsigned char m;
+
+    p0 = dy >> 3;
+    p1 = (dy + h - 1) >> 3;
+    X0 = sx >> 3;
+    X1 = (sx + w - 1) >> 3;
+
+    for(p = p0; p <= p1; p++) {
+        m = page_mask(p, dy, h);
+        row0 = 8 * p - dy + sy;
+        for(k = 0; k < 8; k++) {
+            r = row0 + k;
+            rows[k] = (r >= 0 && r < src.ySize) ? (const unsigned char*)&src.data[r * src.Byte_in_Line] : NULL;
+        }
+        d = &dst.data[p * dst.width + dx - sx];   // indexed by source column
+        for(X = X0; X <= X1; X++) {
+            for(k = 0; k < 8; k++) z[k] = rows[k] ? rows[k][X] : 0;
+            transpose8(z, 1, c);
+            j0 = (8 * X > sx) ? 8 * X : sx;
+            j1 = (8 * X + 7 < sx + w - 1) ? 8 * X + 7 : sx + w - 1;
+            for(j = j0; j <= j1; j++) {
+                d[j] = rop_apply<ROP>(d[j], c[7 - (j - 8 * X)], m);
+            }
+        }
+    }
+}
+
+void bitblt(const PageBitmap& dst, int dx, int dy, const PageBitmap& src, int sx, int sy, int w, int h, int rop)
+{
+    if(!blit_clip(0, 0, dst.width - 1, dst.height - 1, src.width, src.height, dx, dy, sx, sy, w, h)) return;
+    switch(rop) {
+        case BLT_COPY:
+            blit_pages<BLT_COPY>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+        case BLT_OR:
+            blit_pages<BLT_OR>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+        case BLT_AND:
+            blit_pages<BLT_AND>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+        case BLT_XOR:
+            blit_pages<BLT_XOR>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+        case BLT_NOT:
+            blit_pages<BLT_NOT>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+    }
+}
+
+void bitblt(const PageBitmap& dst, int dx, int dy, const Bitmap& src, int sx, int sy, int w, int h, int rop)
+{
+    if(!blit_clip(0, 0, dst.width - 1, dst.height - 1, src.xSize, src.ySize, dx, dy, sx, sy, w, h)) return;
+    switch(rop) {
+        case BLT_COPY:
+            blit_rows<BLT_COPY>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+        case BLT_OR:
+            blit_rows<BLT_OR>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+        case BLT_AND:
+            blit_rows<BLT_AND>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+        case BLT_XOR:
+            blit_rows<BLT_XOR>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+        case BLT_NOT:
+            blit_rows<BLT_NOT>(dst, dx, dy, src, sx, sy, w, h);
+            break;
+    }
+}
+
+const unsigned char* unpack_page(const unsigned char* src, unsigned char* dst, int width)
+{
+    int i = 0;
+    int n;
+
+    while(i < width) {
+        n = *src++;
+        if(n < 128) {                 // n + 1 bytes
+            for(n++; n > 0; n--, src++) {
+                if(i < width) dst[i++] = *src;
+            }
+        } else {                      // run of one byte
+            for(n -= 126; n > 0 && i < width; n--) dst[i++] = *src;
+            src++;
+        }
+    }
+    return src;
+}
+
+int bitmap_pixel(const Bitmap& bm, int x, int y)
+{
+    if(x < 0 || y < 0 || x >= bm.xSize || y >= bm.ySize) return 0;
+    return (bm.data[bm.Byte_in_Line * y + (x >> 3)] >> (7 - (x & 7))) & 1;
+}
+
+int bitmap_pixel(const PageBitmap& bm, int x, int y)
+{
+    if(x < 0 || y < 0 || x >= bm.width || y >= bm.height) return 0;
+    return (bm.data[(y >> 3) * bm.width + x] >> (y & 7)) & 1;
+}
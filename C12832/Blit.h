@@ -0,0 +1,121 @@
+/* 1bpp bit block transfer for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * Copies rectangles between 1 bit per pixel surfaces with a raster
+ * operation. The destination is always in the page layout of the LCD
+ * (the framebuffer or an off-screen PageBitmap), the source can be a
+ * page layout or a row layout Bitmap. Whole bytes are shifted and
+ * masked, a row layout source is turned into columns by 8x8 blocks.
+ */
+
+#ifndef BLIT_H
+#define BLIT_H
+
+/** Bitmap
+  * row by row, Byte_in_Line bytes per row, bit 7 = left pixel
+  */
+struct Bitmap{
+    int xSize;
+    int ySize;
+    int Byte_in_Line;
+    char* data;
+    };
+
+/** PageBitmap
+  * layout of the lcd ram : (height + 7) / 8 pages of width bytes,
+  * one byte holds 8 vertical pixel, bit 0 = top row
+  */
+struct PageBitmap {
+    int width;
+    int height;
+    unsigned char* data;
+};
+
+/** PackedBitmap
+  * page layout with run length coding, made by tools/fontconv -b.
+  * The pages follow each other, each run is a count byte n and
+  *   n < 128   n + 1 bytes copied
+  *   n >= 128  the next byte n - 126 times
+  * width up to 128
+  */
+struct PackedBitmap {
+    int width;
+    int height;
+    const unsigned char* data;
+};
+
+/** raster operation, d = destination pixel, s = source pixel
+  * BLT_COPY d = s
+  * BLT_OR   d = d | s
+  * BLT_AND  d = d & s
+  * BLT_XOR  d = d ^ s
+  * BLT_NOT  d = !s
+  */
+enum {BLT_COPY, BLT_OR, BLT_AND, BLT_XOR, BLT_NOT};
+
+/** cut a blit to the destination window and the source
+  *
+  * @param x0,y0,x1,y1 destination window, corners included
+  * @param sw,sh size of the source
+  * @param dx,dy destination position, adjusted
+  * @param sx,sy source position, adjusted
+  * @param w,h size, adjusted
+  * @returns 0 if nothing is left
+  */
+int blit_clip(int x0, int y0, int x1, int y1, int sw, int sh, int& dx, int& dy, int& sx, int& sy, int& w, int& h);
+
+/** copy a rectangle of a page bitmap
+  *
+  * source and destination may be the same bitmap,
+  * overlapping rectangles are copied like memmove
+  *
+  * @param dst destination
+  * @param dx,dy position in the destination
+  * @param src source
+  * @param sx,sy top left corner in the source
+  * @param w,h size
+  * @param rop raster operation
+  */
+void bitblt(const PageBitmap& dst, int dx, int dy, const PageBitmap& src, int sx, int sy, int w, int h, int rop);
+
+/** copy a rectangle of a row bitmap
+  *
+  * @param dst destination
+  * @param dx,dy position in the destination
+  * @param src source, bit 7 = left pixel
+  * @param sx,sy top left corner in the source
+  * @param w,h size
+  * @param rop raster operation
+  */
+void bitblt(const PageBitmap& dst, int dx, int dy, const Bitmap& src, int sx, int sy, int w, int h, int rop);
+
+/** unpack one page of a packed bitmap
+  *
+  * @param src start of the page in the data
+  * @param dst width bytes
+  * @param width width of the bitmap
+  * @returns start of the next page
+  */
+const unsigned char* unpack_page(const unsigned char* src, unsigned char* dst, int width);
+
+/** transpose an 8x8 bit matrix
+  *
+  * bit r of in[i * stride] goes to bit i of out[r]. Eight columns of a
+  * page layout (bit 0 = top row) become eight rows with bit 0 = left
+  * pixel, and eight rows become eight columns the same way. A row
+  * bitmap has bit 7 = left pixel, so its left column is out[7].
+  *
+  * @param in first of the 8 source bytes
+  * @param stride distance between the source bytes
+  * @param out 8 bytes
+  */
+void transpose8(const unsigned char* in, int stride, unsigned char* out);
+
+/** read one pixel of a bitmap
+  *
+  * @returns 1 if set, 0 if clear or outside
+  */
+int bitmap_pixel(const Bitmap& bm, int x, int y);
+int bitmap_pixel(const PageBitmap& bm, int x, int y);
+
+#endif
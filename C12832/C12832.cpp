@@ -0,0 +1,2485 @@
+/* mbed library for the mbed Lab Board  128*32 pixel LCD
+ * use C12832 controller
+ * Copyright (c) 2012 Peter Drescher - DC2PD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// 13.10.12    initial design
+// 25.10.12    add autorefresh of screen
+// 25.10.12    add standart font
+// 20.12.12    add bitmap graphics
+// 16.10.26    track dirty columns per page, copy_to_lcd only sends changes
+// 16.10.26    add flush_async, DMA driven update on STM32F4
+// 16.10.26    send pages as one burst, CS once per block
+// 16.10.26    add begin_frame / end_frame, printf draws one frame
+// 16.10.26    add hline / vline / fill_area working on page bytes
+// 16.10.26    character writes whole font columns into the page bytes
+// 16.10.26    add page fonts with pre-shifted glyphs, see PageFont.h
+// 16.10.26    draw mode and orientation as template policies, see Raster.h
+// 16.10.26    add clip rectangle, primitives are clipped before drawing
+// 16.10.26    fillcircle by spans, add fillroundrect, filltriangle, fillpolygon
+// 16.10.26    add blit with raster ops, print_bm uses it, see Blit.h
+// 16.10.26    add scroll by the start line register and a terminal mode
+// 16.10.26    add get_clip and char_width, used by TextGrid
+// 16.10.26    add background and overlay layers, put together at the update
+// 16.10.26    add get_area, used by SpriteManager
+// 16.10.26    add packed fonts with a cache of decoded glyphs, packed bitmaps
+// 16.10.26    parts can be switched off at compile time, see C12832_config.h
+// 16.10.26    fill, fill_span, blit, blitbit, blit_native of GraphicsDisplay on whole bytes
+// 16.10.26    fonts of one byte per column drawn column by column, an 8x8 cell on a page row is one copy
+// 16.10.26    add set_orientation, 180 degree by the controller, text and blits by panel columns in portrait
+// 16.10.26    add a shadow of the controller RAM, an update only sends the runs that differ
+// 16.10.26    the panel is a device on an SPIBus, several panels can share the SPI
+
+// optional defines :
+// #define debug_lcd  1
+
+#include "C12832.h"
+#include "mbed.h"
+#include "stdio.h"
+#include "stdarg.h"
+#include "Small_7.h"
+#include "PageFont.h"
+#include "Raster.h"
+
+#if defined(TARGET_STM32F4)
+#include "pinmap.h"
+#include "PeripheralPins.h"
+#endif
+
+#define BPP    1       // Bits per pixel
+#define TERM_COLS  32  // chars per line in the terminal ring
+#define RUN_GAP    3   // equal bytes sent with a run, a new run costs 3 command bytes
+
+
+C12832::C12832(PinName mosi, PinName sck, PinName reset, PinName a0, PinName ncs, const char* name)
+    : GraphicsDisplay(name),_reset(reset),_A0(a0),_CS(ncs)
+{
+    _own_bus = new SPIBus(mosi, NC, sck);
+    init(*_own_bus);
+}
+
+C12832::C12832(SPIBus& bus, PinName reset, PinName a0, PinName ncs, const char* name)
+    : GraphicsDisplay(name),_reset(reset),_A0(a0),_CS(ncs)
+{
+    _own_bus = NULL;
+    init(bus);
+}
+
+C12832::~C12832()
+{
+    while(busy());     // the running pass uses the device
+    delete _dev;
+    if(_own_bus != NULL) delete _own_bus;
+}
+
+void C12832::init(SPIBus& bus)
+{
+#if C12832_LAYERS || C12832_PACKED_FONTS
+    int i;
+#endif
+#if C12832_LAYERS
+    int page;
+#endif
+
+    _dev = new SPIDevice(bus, NC, 8, 3, 20000000);   // 8 bit spi mode 3, 20 MHz, CS set here
+    orientation = 1;
+    col_offset = 0;
+    line_offset = 0;
+    draw_mode = NORMAL;
+    reset_clip();
+    char_x = 0;
+    frame_depth = 0;
+    flush_count = 0;
+    dma_page = -1;
+    dma_again = 0;
+    dma_index = -1;
+#if C12832_SHADOW
+    shadow_ok = 0;
+#endif
+#if C12832_TERMINAL
+    term_buf = NULL;
+    term_lines = 0;
+    term_back = 0;
+#endif
+#if C12832_LAYERS
+    for(i = 0; i < 3; i++) {
+        layer_buf[i] = NULL;
+        layer_rule[i] = LAYER_OR;
+        for(page = 0; page < 4; page++) {
+            layer_min[i][page] = 128;   // nothing drawn
+            layer_max[i][page] = 0;
+        }
+    }
+    layer_buf[LAYER_CONTENT] = (unsigned char*)frame;
+    layer_shown = 1 << LAYER_CONTENT;
+    draw_layer = LAYER_CONTENT;
+#endif
+#if C12832_PACKED_FONTS
+    for(i = 0; i < GLYPH_CACHE; i++) {
+        glyph_cache[i].font = NULL;
+        glyph_cache[i].used = 0;
+    }
+    glyph_tick = 0;
+    glyph_decodes = 0;
+#endif
+    buffer = (unsigned char*)frame;
+#if defined(TARGET_STM32F4)
+    SPI_TypeDef* spi = (SPI_TypeDef*)pinmap_peripheral(bus.get_mosi(), PinMap_SPI_MOSI);
+    if(spi == SPI1) dma_index = 0;
+    else if(spi == SPI2) dma_index = 1;
+    else if(spi == SPI3) dma_index = 2;
+#endif
+    lcd_reset();
+}
+
+
+int C12832::width()
+{
+    if (orientation == 0 || orientation == 2) return 32;
+    else return 128;
+}
+
+int C12832::height()
+{
+    if (orientation == 0 || orientation == 2) return 128;
+    else return 32;
+}
+
+// 180 degree by the controller : segment 131 is column 0 and the common
+// lines are scanned from the other end. The panel shows segment 0..127
+// and common 63..32, so RAM column x + 4 is screen column x and the
+// screen starts 32 lines after the start line register.
+
+void C12832::set_orientation(unsigned int o)
+{
+    o &= 3;
+    while(busy());     // the running pass uses the old offsets
+    orientation = o;
+    col_offset = (o >= 2) ? 4 : 0;
+    line_offset = (o >= 2) ? 32 : 0;
+    _dev->lock();
+    wr_cmd(col_offset ? 0xA1 : 0xA0);   // segment direction
+    wr_cmd(col_offset ? 0xC0 : 0xC8);   // common direction
+    _dev->unlock();
+    start_line = -1;                    // start line register with the new offset
+    reset_clip();
+    locate(0, 0);
+    invalidate();      // all columns move by the offset
+    copy_to_lcd();
+}
+
+unsigned int C12832::get_orientation(void)
+{
+    return orientation;
+}
+
+
+void C12832::invert(unsigned int o)
+{
+    while(busy());     // wait for a running update
+    _dev->lock();
+    if(o == 0) wr_cmd(0xA6);
+    else wr_cmd(0xA7);
+    _dev->unlock();
+}
+
+
+void C12832::set_contrast(unsigned int o)
+{
+    contrast = o;
+    while(busy());     // wait for a running update
+    _dev->lock();
+    wr_cmd(0x81);      //  set volume
+    wr_cmd(o & 0x3F);
+    _dev->unlock();
+}
+
+unsigned int C12832::get_contrast(void)
+{
+    return(contrast);
+}
+
+
+#if defined(TARGET_STM32F4)
+
+// SPI registers and TX DMA requests of the STM32F4 (reference manual, DMA request mapping)
+typedef struct {
+    SPI_TypeDef* spi;
+    DMA_TypeDef* dma;
+    DMA_Stream_TypeDef* stream;
+    unsigned int stream_no;
+    unsigned int channel;
+    IRQn_Type irq;
+} lcd_dma_t;
+
+static const lcd_dma_t lcd_dma[3] = {
+    {SPI1, DMA2, DMA2_Stream3, 3, 3, DMA2_Stream3_IRQn},
+    {SPI2, DMA1, DMA1_Stream4, 4, 0, DMA1_Stream4_IRQn},
+    {SPI3, DMA1, DMA1_Stream5, 5, 0, DMA1_Stream5_IRQn},
+};
+
+#endif
+
+// write command to lcd controller
+// the caller has taken the bus, so a whole update needs it only once
+// and can also run from a request() of the bus
+
+void C12832::wr_cmd(unsigned char cmd)
+{
+    _A0 = 0;
+    _CS = 0;
+    _dev->bus().spi().write(cmd);
+    _CS = 1;
+}
+
+// write data to lcd controller
+
+void C12832::wr_dat(unsigned char dat)
+{
+    _A0 = 1;
+    _CS = 0;
+    _dev->bus().spi().write(dat);
+    _CS = 1;
+}
+
+// write a block of commands, CS only once
+
+void C12832::wr_cmd_block(const uint8_t* cmd, size_t n)
+{
+    _A0 = 0;
+    _CS = 0;
+    spi_burst(cmd, n);
+    _CS = 1;
+}
+
+// write a block of data, CS only once
+
+void C12832::wr_dat_block(const uint8_t* dat, size_t n)
+{
+    _A0 = 1;
+    _CS = 0;
+    spi_burst(dat, n);
+    _CS = 1;
+}
+
+// send bytes back to back
+// SPI::write waits for the received byte after every byte,
+// on the STM32F4 the data register is written as soon as it is empty
+// so the shift register never runs dry
+
+void C12832::spi_burst(const uint8_t* p, size_t n)
+{
+#if defined(TARGET_STM32F4)
+    if(dma_index >= 0) {
+        SPI_TypeDef* spi = lcd_dma[dma_index].spi;
+        spi->CR1 |= SPI_CR1_SPE;
+        while(n--) {
+            while((spi->SR & SPI_SR_TXE) == 0);
+            spi->DR = *p++;
+        }
+        while((spi->SR & SPI_SR_TXE) == 0);
+        while(spi->SR & SPI_SR_BSY);  // last byte out before CS goes high
+        (void)spi->DR;                // drop rx data and overrun flag
+        (void)spi->SR;
+        return;
+    }
+#endif
+    while(n--) {
+        _dev->bus().spi().write(*p++);
+    }
+}
+
+// reset and init the lcd controller
+
+void C12832::lcd_reset()
+{
+
+    // 8 bit spi mode 3 and the clock are set by the bus for _dev
+    _A0 = 0;
+    _CS = 1;
+    _reset = 0;                        // display reset
+    wait_us(50);
+    _reset = 1;                       // end reset
+    wait_ms(5);
+
+    /* Start Initial Sequence ----------------------------------------------------*/
+
+    while(busy());     // wait for a running update
+    _dev->lock();
+    wr_cmd(0xAE);   //  display off
+    wr_cmd(0xA2);   //  bias voltage
+
+    wr_cmd(col_offset ? 0xA1 : 0xA0);   //  segment direction
+    wr_cmd(col_offset ? 0xC0 : 0xC8);   //  common direction, colum normal
+
+    wr_cmd(0x22);   //  voltage resistor ratio
+    wr_cmd(0x2F);   //  power on
+    //wr_cmd(0xA4);   //  LCD display ram
+    scroll_line = 0;
+    start_line = 0;
+    wr_cmd(0x40 | line_offset);   // start line = 0
+    wr_cmd(0xAF);     // display ON
+
+    wr_cmd(0x81);   //  set contrast
+    wr_cmd(0x17);   //  set contrast
+
+    wr_cmd(0xA6);     // display normal
+    _dev->unlock();
+
+
+    // clear and update LCD
+    memset(buffer,0x00,512);  // clear display buffer
+    invalidate();             // controller ram is undefined after reset
+    copy_to_lcd();
+#if C12832_AUTO_UP
+    auto_up = 1;              // switch on auto update
+#endif
+    // dont do this by default. Make the user call
+    //claim(stdout);           // redirekt printf to lcd
+    locate(0,0);
+    set_font((unsigned char*)Small_7);  // standart font
+}
+
+// set one pixel in buffer
+
+struct PixelOp {
+    int x, y;
+    PixelOp(int px, int py) : x(px), y(py) {}
+    template <class R> void operator()(R r) { r.plot(x, y); }
+};
+
+void C12832::pixel(int x, int y, int color)
+{
+    // first check parameter
+    if(x < clip_x0 || x > clip_x1 || y < clip_y0 || y > clip_y1) return;
+
+    PixelOp op(x, y);
+    dispatch(buffer, orientation, draw_mode, color, op);
+    mark_area(x, y, x, y);
+}
+
+// map a screen position to the panel, 2 and 3 have the layout of 0 and 1
+
+void C12832::to_panel(int& x, int& y)
+{
+    int t;
+    if(orientation & 1) return;
+    t = x;
+    x = Rot0::px(x, y);
+    y = Rot0::py(t, y);
+}
+
+// clip a rectangle and mark it as changed
+
+void C12832::mark_clipped(int x0, int y0, int x1, int y1)
+{
+    if(x0 < clip_x0) x0 = clip_x0;
+    if(y0 < clip_y0) y0 = clip_y0;
+    if(x1 > clip_x1) x1 = clip_x1;
+    if(y1 > clip_y1) y1 = clip_y1;
+    if(x0 > x1 || y0 > y1) return;
+    mark_area(x0, y0, x1, y1);
+}
+
+// mark a screen rectangle as changed
+
+void C12832::mark_area(int x0, int y0, int x1, int y1)
+{
+    int page, t;
+
+    to_panel(x0, y0);
+    to_panel(x1, y1);
+    if(x0 > x1) {
+        t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if(y0 > y1) {
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if(y0 < 0) y0 = 0;
+    if(y1 > 31) y1 = 31;
+    for(page = y0 >> 3; page <= (y1 >> 3); page++) {
+        mark_dirty(page, x0, x1);
+    }
+}
+
+// remember which part of the buffer has to be sent
+
+void C12832::mark_dirty(int page, int x0, int x1)
+{
+    if(page < 0 || page > 3) return;
+    if(x0 < 0) x0 = 0;
+    if(x1 > 127) x1 = 127;
+    if(x0 > x1) return;
+#if C12832_LAYERS
+    if(x0 < layer_min[draw_layer][page]) layer_min[draw_layer][page] = x0;
+    if(x1 > layer_max[draw_layer][page]) layer_max[draw_layer][page] = x1;
+    if(!(layer_shown & (1 << draw_layer))) return;   // hidden, the screen does not change
+#endif
+    __disable_irq();                  // a pass started meanwhile takes both or none
+    if(x0 < dirty_min[page]) dirty_min[page] = x0;
+    if(x1 > dirty_max[page]) dirty_max[page] = x1;
+    __enable_irq();
+}
+
+// clip rectangle, limited to the screen
+// x0 > x1 after limiting : nothing is drawn
+
+void C12832::set_clip(int x0, int y0, int x1, int y1)
+{
+    int t;
+    if(x0 > x1) {
+        t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if(y0 > y1) {
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 >= width()) x1 = width() - 1;
+    if(y1 >= height()) y1 = height() - 1;
+    clip_x0 = x0;
+    clip_y0 = y0;
+    clip_x1 = x1;
+    clip_y1 = y1;
+}
+
+void C12832::reset_clip(void)
+{
+    clip_x0 = 0;
+    clip_y0 = 0;
+    clip_x1 = width() - 1;
+    clip_y1 = height() - 1;
+}
+
+void C12832::get_clip(int& x0, int& y0, int& x1, int& y1)
+{
+    x0 = clip_x0;
+    y0 = clip_y0;
+    x1 = clip_x1;
+    y1 = clip_y1;
+}
+
+void C12832::invalidate(void)
+{
+    mark_all();
+#if C12832_SHADOW
+    shadow_ok = 0;     // send all, the lcd may show something else
+#endif
+}
+
+void C12832::mark_all(void)
+{
+    int page;
+
+    __disable_irq();
+    for(page = 0; page < 4; page++) {
+        dirty_min[page] = 0;
+        dirty_max[page] = 127;
+    }
+    __enable_irq();
+}
+
+// RAM pages of the controller
+// the screen starts at RAM line scroll_line. If it is a multiple of 8
+// framebuffer page k is RAM page (scroll_line / 8 + k), else RAM page k
+// (k = 0..4) holds the lower rows of framebuffer page k - 1 and the upper
+// rows of page k, moved down by scroll_line % 8.
+
+// dirty column span of RAM page k
+
+int C12832::ram_span(int k, int s, int& x0, int& x1)
+{
+    x0 = 128;
+    x1 = 0;
+    if(s == 0) {
+        x0 = dirty_min[k];
+        x1 = dirty_max[k];
+    } else {
+        if(k > 0 && dirty_min[k - 1] <= dirty_max[k - 1]) {
+            x0 = dirty_min[k - 1];
+            x1 = dirty_max[k - 1];
+        }
+        if(k < 4 && dirty_min[k] <= dirty_max[k]) {
+            if(dirty_min[k] < x0) x0 = dirty_min[k];
+            if(dirty_max[k] > x1) x1 = dirty_max[k];
+        }
+    }
+    return x0 <= x1;
+}
+
+// take the spans and clear them in one go with the interrupts off.
+// A pass started by an interrupt in the middle of a mark_dirty() of the
+// main program would else take x0 and clear the span before x1 is set.
+
+void C12832::take_spans(int s, int pages, unsigned char* x0, unsigned char* x1)
+{
+    int k, page, a, b;
+
+    __disable_irq();
+    for(k = 0; k < pages; k++) {
+        if(ram_span(k, s, a, b)) {
+            x0[k] = a;
+            x1[k] = b;
+        } else {
+            x0[k] = 128;              // clean
+            x1[k] = 0;
+        }
+    }
+    for(page = 0; page < 4; page++) {
+        dirty_min[page] = 128;        // changes from now on go to the next pass
+        dirty_max[page] = 0;
+    }
+    __enable_irq();
+}
+
+// bytes of RAM page k from column x0 on
+
+const unsigned char* C12832::ram_data(int k, int s, int x0, int n)
+{
+    const unsigned char* lo = NULL;
+    const unsigned char* up = NULL;
+    unsigned char* out = (unsigned char*)line_buf + x0;   // aligned like the shadow
+    int i;
+    unsigned char b;
+
+    if(s == 0) return page_data(k, x0, x0 + n - 1, 0);
+    if(k < 4) lo = page_data(k, x0, x0 + n - 1, 0);
+    if(k > 0) up = page_data(k - 1, x0, x0 + n - 1, 1);
+    for(i = 0; i < n; i++) {
+        b = 0;
+        if(lo) b = lo[i] << s;
+        if(up) b |= up[i] >> (8 - s);
+        out[i] = b;
+    }
+    return out;
+}
+
+// layers
+// the shown layers of a page are put together 4 columns at a time,
+// only for the dirty spans of the update
+
+const unsigned char* C12832::page_data(int page, int x0, int x1, int slot)
+{
+#if C12832_LAYERS
+    uint32_t* out = comp_buf[slot];
+    const uint32_t* src;
+    int l, i, w0, w1;
+
+    if(layer_shown == (1 << LAYER_CONTENT) && layer_rule[LAYER_CONTENT] != LAYER_MASK) {
+        return &layer_buf[LAYER_CONTENT][page * 128 + x0];   // only the content
+    }
+    w0 = x0 >> 2;
+    w1 = x1 >> 2;
+    for(i = w0; i <= w1; i++) out[i] = 0;
+    for(l = 0; l < 3; l++) {
+        if(!(layer_shown & (1 << l))) continue;
+        src = (const uint32_t*)layer_buf[l] + page * 32;
+        switch(layer_rule[l]) {
+            case LAYER_XOR:
+                for(i = w0; i <= w1; i++) out[i] ^= src[i];
+                break;
+            case LAYER_MASK:
+                for(i = w0; i <= w1; i++) out[i] &= ~src[i];
+                break;
+            default:
+                for(i = w0; i <= w1; i++) out[i] |= src[i];
+        }
+    }
+    return (const unsigned char*)out + x0;
+#else
+    (void)x1;                         // only the content, nothing to put together
+    (void)slot;
+    return (const unsigned char*)frame + page * 128 + x0;
+#endif
+}
+
+#if C12832_LAYERS
+void C12832::alloc_layer(int layer)
+{
+    uint32_t* p;
+
+    if(layer_buf[layer] != NULL) return;
+    p = new uint32_t[128];
+    memset(p, 0x00, 512);
+    layer_buf[layer] = (unsigned char*)p;
+}
+
+void C12832::mark_layer(int layer)
+{
+    int page;
+
+    for(page = 0; page < 4; page++) {
+        if(layer_min[layer][page] > layer_max[layer][page]) continue;
+        __disable_irq();
+        if(layer_min[layer][page] < dirty_min[page]) dirty_min[page] = layer_min[layer][page];
+        if(layer_max[layer][page] > dirty_max[page]) dirty_max[page] = layer_max[layer][page];
+        __enable_irq();
+    }
+}
+
+void C12832::select_layer(int layer)
+{
+    if(layer < LAYER_BACKGROUND || layer > LAYER_OVERLAY) return;
+    alloc_layer(layer);
+    draw_layer = layer;
+    buffer = layer_buf[layer];
+}
+
+int C12832::get_layer(void)
+{
+    return draw_layer;
+}
+
+void C12832::show_layer(int layer, unsigned int on)
+{
+    unsigned int bit;
+
+    if(layer < LAYER_BACKGROUND || layer > LAYER_OVERLAY) return;
+    bit = 1 << layer;
+    if(((layer_shown & bit) != 0) == (on != 0)) return;
+    alloc_layer(layer);
+    layer_shown ^= bit;
+    mark_layer(layer);                // the layers below show through again
+    update();
+}
+
+void C12832::set_layer_rule(int layer, int rule)
+{
+    if(layer < LAYER_BACKGROUND || layer > LAYER_OVERLAY) return;
+    if(layer_rule[layer] == rule) return;
+    layer_rule[layer] = rule;
+    if(layer_shown & (1 << layer)) {
+        mark_layer(layer);
+        update();
+    }
+}
+#endif
+
+#if C12832_SHADOW
+// first byte from i on where a and b differ,
+// 4 bytes at a time if both are aligned alike
+
+static int diff_from(const unsigned char* a, const unsigned char* b, int i, int n)
+{
+    if((((uintptr_t)a ^ (uintptr_t)b) & 3) == 0) {
+        while(i < n && (((uintptr_t)(a + i)) & 3) && a[i] == b[i]) i++;
+        if(i < n && (((uintptr_t)(a + i)) & 3) == 0) {
+            while(i + 4 <= n && *(const uint32_t*)(a + i) == *(const uint32_t*)(b + i)) i += 4;
+        }
+    }
+    while(i < n && a[i] == b[i]) i++;
+    return i;
+}
+#endif
+
+// shadow of the controller RAM
+// a redrawn screen has the same bytes as the lcd in most columns, the
+// dirty spans are compared with the shadow and only the differing runs
+// are sent. A RAM page is known after it has been sent completely.
+
+int C12832::next_run(int page, const unsigned char* d, int x0, int n, int i, int& len)
+{
+#if C12832_SHADOW
+    unsigned char* sh = (unsigned char*)shadow[page] + x0;
+    int j, end;
+
+    if(i >= n) return n;
+    if(shadow_ok & (1 << page)) {
+        i = diff_from(d, sh, i, n);
+        if(i >= n) return n;          // the lcd shows it already
+        end = i + 1;
+        for(;;) {
+            j = diff_from(d, sh, end, n);
+            if(j >= n || j - end > RUN_GAP) break;
+            end = j + 1;
+        }
+        len = end - i;
+    } else {
+        len = n - i;
+        if(x0 + i == 0 && len == 128) shadow_ok |= 1 << page;
+    }
+    memcpy(sh + i, d + i, len);
+    return i;
+#else
+    (void)page;                       // the rest is one run
+    (void)d;
+    (void)x0;
+    if(i >= n) return n;
+    len = n - i;
+    return i;
+#endif
+}
+
+// update lcd
+
+void C12832::copy_to_lcd(void)
+{
+    while(busy());     // wait for a running update
+    _dev->lock();
+    send_pass();
+    _dev->unlock();
+}
+
+// one update with the bus taken
+// only the dirty column span of each page is sent, with the shadow
+// only the runs that differ from the lcd,
+// the start line follows after the data so a scroll shows no old rows
+
+void C12832::send_pass(void)
+{
+    int k, pages, s, x0, page, n, i, len;
+    unsigned char x0s[5], x1s[5];
+    const unsigned char* data;
+    uint8_t cmd[3];
+
+    bytes_sent = 0;
+    s = scroll_line & 7;
+    pages = s ? 5 : 4;
+    take_spans(s, pages, x0s, x1s);
+    for(k = 0; k < pages; k++) {
+        if(x0s[k] > x1s[k]) continue;   // page unchanged
+
+        page = ((scroll_line >> 3) + k) & 7;
+        x0 = x0s[k];
+        n = x1s[k] - x0 + 1;
+        data = ram_data(k, s, x0, n);
+        for(i = next_run(page, data, x0, n, 0, len); i < n; i = next_run(page, data, x0, n, i + len, len)) {
+            cmd[0] = 0x00 | ((x0 + i + col_offset) & 0x0F);  // set column low nibble
+            cmd[1] = 0x10 | ((x0 + i + col_offset) >> 4);    // set column hi  nibble
+            cmd[2] = 0xB0 | page;                            // set page address
+            wr_cmd_block(cmd, 3);
+            wr_dat_block(data + i, len);
+            bytes_sent += 3 + len;
+        }
+    }
+    if(start_line != scroll_line) {
+        wr_cmd(0x40 | ((scroll_line + line_offset) & 63));   // set start line
+        start_line = scroll_line;
+        bytes_sent++;
+    }
+    bytes_saved = (bytes_sent < 4 * (3 + 128)) ? 4 * (3 + 128) - bytes_sent : 0;
+    flush_count++;
+}
+
+// asynchronous update
+
+#if defined(TARGET_STM32F4)
+
+static C12832* lcd_dma_owner[3];
+
+// clear all interrupt flags of a stream
+static void lcd_dma_clear(const lcd_dma_t* d)
+{
+    static const unsigned char shift[4] = {0, 6, 16, 22};
+    if(d->stream_no < 4) d->dma->LIFCR = 0x3DUL << shift[d->stream_no];
+    else d->dma->HIFCR = 0x3DUL << shift[d->stream_no - 4];
+}
+
+void lcd_dma_irq(int n)
+{
+    lcd_dma_clear(&lcd_dma[n]);
+    if(lcd_dma_owner[n] != NULL) lcd_dma_owner[n]->dma_isr();
+}
+
+static void lcd_dma_irq0(void) { lcd_dma_irq(0); }
+static void lcd_dma_irq1(void) { lcd_dma_irq(1); }
+static void lcd_dma_irq2(void) { lcd_dma_irq(2); }
+
+static const uint32_t lcd_dma_vector[3] = {
+    (uint32_t)(uintptr_t)lcd_dma_irq0, (uint32_t)(uintptr_t)lcd_dma_irq1, (uint32_t)(uintptr_t)lcd_dma_irq2
+};
+
+// find the next run, send its address commands and start the DMA for the data.
+// The data of a RAM page is put together when the page starts.
+
+void C12832::start_dma_page(void)
+{
+    const lcd_dma_t* d = &lcd_dma[dma_index];
+    SPI_TypeDef* spi = d->spi;
+    unsigned char cmd[3];
+    int i, x0, n, page;
+
+    page = 0;
+    x0 = 0;
+    while(dma_page < dma_pages) {
+        x0 = dma_x0[dma_page];
+        n = dma_x1[dma_page] - x0 + 1;
+        page = ((dma_line >> 3) + dma_page) & 7;
+        if(n > 0) {
+            if(dma_data == NULL) {
+                dma_data = ram_data(dma_page, dma_line & 7, x0, n);
+                dma_run = 0;
+                dma_len = 0;
+            }
+            dma_run = next_run(page, dma_data, x0, n, dma_run + dma_len, dma_len);
+            if(dma_run < n) break;
+        }
+        dma_page++;                   // page done or clean
+        dma_data = NULL;
+    }
+    if(dma_page >= dma_pages) {       // pass done
+        if(start_line != dma_line) {  // start line after the data
+            _A0 = 0;
+            _CS = 0;
+            spi->CR1 |= SPI_CR1_SPE;
+            while((spi->SR & SPI_SR_TXE) == 0);
+            spi->DR = 0x40 | ((dma_line + line_offset) & 63);
+            while((spi->SR & SPI_SR_TXE) == 0);
+            while(spi->SR & SPI_SR_BSY);
+            _CS = 1;
+            (void)spi->DR;
+            (void)spi->SR;
+            start_line = dma_line;
+            bytes_sent++;
+        }
+        bytes_saved = (bytes_sent < 4 * (3 + 128)) ? 4 * (3 + 128) - bytes_sent : 0;
+        if(dma_again) {               // a waiting device goes first
+            _dev->unlock();
+            _dev->request(callback(this, &C12832::start_dma_pass));
+            return;
+        }
+        dma_page = -1;
+        _dev->unlock();
+        if(flush_done) flush_done();
+        return;
+    }
+    x0 += dma_run;
+    cmd[0] = 0x00 | ((x0 + col_offset) & 0x0F);   // set column low nibble
+    cmd[1] = 0x10 | ((x0 + col_offset) >> 4);     // set column hi  nibble
+    cmd[2] = 0xB0 | page;                         // set page address
+    bytes_sent += 3 + dma_len;
+
+    // command phase, 3 bytes polled
+    _A0 = 0;
+    _CS = 0;
+    spi->CR1 |= SPI_CR1_SPE;
+    for(i = 0; i < 3; i++) {
+        while((spi->SR & SPI_SR_TXE) == 0);
+        spi->DR = cmd[i];
+    }
+    while((spi->SR & SPI_SR_TXE) == 0);
+    while(spi->SR & SPI_SR_BSY);
+    _A0 = 1;
+
+    // data phase by DMA, memory -> SPI DR, 8 bit, interrupt at transfer complete
+    d->stream->CR &= ~DMA_SxCR_EN;
+    while(d->stream->CR & DMA_SxCR_EN);
+    lcd_dma_clear(d);
+    d->stream->PAR = (uint32_t)(uintptr_t)&spi->DR;
+    d->stream->M0AR = (uint32_t)(uintptr_t)(dma_data + dma_run);
+    d->stream->NDTR = dma_len;
+    d->stream->FCR = 0;
+    d->stream->CR = (d->channel << 25) | DMA_SxCR_MINC | DMA_SxCR_DIR_0 | DMA_SxCR_TCIE;
+    d->stream->CR |= DMA_SxCR_EN;
+    spi->CR2 |= SPI_CR2_TXDMAEN;
+}
+
+// DMA transfer complete : finish the run and start the next one
+
+void C12832::dma_isr(void)
+{
+    SPI_TypeDef* spi = lcd_dma[dma_index].spi;
+
+    while((spi->SR & SPI_SR_TXE) == 0);   // last byte is still shifted out
+    while(spi->SR & SPI_SR_BSY);
+    spi->CR2 &= ~SPI_CR2_TXDMAEN;
+    _CS = 1;
+    (void)spi->DR;                        // drop rx data and overrun flag
+    (void)spi->SR;
+
+    start_dma_page();
+}
+
+#endif
+
+// take the dirty spans for a new pass,
+// the bytes sent are counted as the runs are found
+
+void C12832::start_dma_pass(void)
+{
+    dma_again = 0;
+    bytes_sent = 0;
+    dma_line = scroll_line;
+    dma_pages = (dma_line & 7) ? 5 : 4;
+    take_spans(dma_line & 7, dma_pages, dma_x0, dma_x1);
+    flush_count++;
+    dma_page = 0;
+    dma_data = NULL;
+#if defined(TARGET_STM32F4)
+    lcd_dma_owner[dma_index] = this;  // the stream is shared by the panels of the bus
+    start_dma_page();
+#endif
+}
+
+void C12832::flush_async(void)
+{
+#if defined(TARGET_STM32F4)
+    if(dma_index >= 0) {
+        const lcd_dma_t* d = &lcd_dma[dma_index];
+        __disable_irq();
+        if(busy()) {                  // restart when the running pass is done
+            dma_again = 1;
+            __enable_irq();
+            return;
+        }
+        dma_page = 0;                 // claim the DMA before enabling interrupts
+        __enable_irq();
+        if(lcd_dma_owner[dma_index] == NULL) {   // first use of the stream
+            if(d->dma == DMA1) RCC->AHB1ENR |= RCC_AHB1ENR_DMA1EN;
+            else RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+            NVIC_SetVector(d->irq, lcd_dma_vector[dma_index]);
+            NVIC_EnableIRQ(d->irq);
+        }
+        _dev->request(callback(this, &C12832::start_dma_pass));   // now or after the device before
+        return;
+    }
+#endif
+    // no DMA : an interrupt does not wait for the bus, the update is
+    // sent now if the bus is free, else by the unlock() of the device
+    // that has it. busy() is true until it is done, like a DMA pass.
+    if(core_util_is_isr_active()) {
+        __disable_irq();
+        if(busy()) {
+            dma_again = 1;
+            __enable_irq();
+            return;
+        }
+        dma_page = 0;
+        __enable_irq();
+        _dev->request(callback(this, &C12832::flush_pass));
+        return;
+    }
+    copy_to_lcd();     // blocking update
+    if(flush_done) flush_done();
+}
+
+// update without DMA, started by request() with the bus taken
+
+void C12832::flush_pass(void)
+{
+    dma_again = 0;
+    send_pass();
+    __disable_irq();
+    if(dma_again) {                   // called again meanwhile, a waiting device goes first
+        __enable_irq();
+        _dev->unlock();
+        _dev->request(callback(this, &C12832::flush_pass));
+        return;
+    }
+    dma_page = -1;
+    __enable_irq();
+    _dev->unlock();
+    if(flush_done) flush_done();
+}
+
+bool C12832::busy(void)
+{
+    return dma_page >= 0;
+}
+
+void C12832::attach_flush_done(Callback<void()> func)
+{
+    flush_done = func;
+}
+
+unsigned int C12832::get_bytes_sent(void)
+{
+    return bytes_sent;
+}
+
+unsigned int C12832::get_bytes_saved(void)
+{
+    return bytes_saved;
+}
+
+void C12832::cls(void)
+{
+    memset(buffer,0x00,512);  // clear display buffer
+#if C12832_LAYERS
+    int page;
+
+    for(page = 0; page < 4; page++) {
+        layer_min[draw_layer][page] = 128;   // nothing drawn
+        layer_max[draw_layer][page] = 0;
+    }
+#endif
+    mark_all();        // sent by the next update, in a frame at its end
+#if C12832_SHADOW
+    shadow_ok = 0;
+#endif
+    update();
+}
+
+// Bresenham, all octants
+// The line is clipped before the loop. The steps along the major axis
+// that fall into the clip rectangle are one interval, the loop starts
+// at the first of them with the error term Bresenham would have there.
+// So a clipped line has the same pixel as the whole line.
+
+struct LineOp {
+    int x0, y0, x1, y1;
+    Clip clip;
+    int accept;                       // both end points inside
+    LineOp(int ax, int ay, int bx, int by, const Clip& c, int all) : x0(ax), y0(ay), x1(bx), y1(by), clip(c), accept(all) {}
+    template <class R> void operator()(R r)
+    {
+        int dx = x1 - x0;
+        int dy = y1 - y0;
+        int dx_sym = (dx > 0) ? 1 : -1;
+        int dy_sym = (dy > 0) ? 1 : -1;
+
+        dx = dx_sym * dx;
+        dy = dy_sym * dy;
+        if (dx == 0 && dy == 0) {
+            if (clip.inside(x0, y0)) r.plot(x0, y0);
+        } else if (dx >= dy) {
+            run<0>(r, x0, y0, dx_sym, dy_sym, dx, dy, clip.x0, clip.x1, clip.y0, clip.y1);
+        } else {
+            run<1>(r, y0, x0, dy_sym, dx_sym, dy, dx, clip.y0, clip.y1, clip.x0, clip.x1);
+        }
+    }
+
+    // a = major axis, b = minor axis, SWAP = 1 : a is y
+    // after i steps b has moved by (2*db*i + da) / (2*da)
+    template <int SWAP, class R> void run(R r, int a, int b, int a_sym, int b_sym, int da, int db, int a0, int a1, int b0, int b1)
+    {
+        int i, i0, i1, lo, hi, k, di;
+        int64_t t;
+
+        i0 = 0;
+        i1 = da;
+        if (!accept) {
+            // steps with a inside a0..a1
+            if (a_sym > 0) {
+                lo = a0 - a;
+                hi = a1 - a;
+            } else {
+                lo = a - a1;
+                hi = a - a0;
+            }
+            if (lo > i0) i0 = lo;
+            if (hi < i1) i1 = hi;
+
+            // steps with b inside b0..b1
+            if (b_sym > 0) {
+                lo = b0 - b;
+                hi = b1 - b;
+            } else {
+                lo = b - b1;
+                hi = b - b0;
+            }
+            if (hi < 0 || lo > hi) return;
+            if (db == 0) {
+                if (lo > 0) return;
+            } else {
+                if (lo > 0) {             // first step with b moved by lo
+                    t = ((int64_t)2 * da * lo - da + 2 * db - 1) / (2 * db);
+                    if (t > i0) i0 = (int)t;
+                }
+                t = ((int64_t)2 * da * (hi + 1) - da - 1) / (2 * db);   // last step with b moved by hi
+                if (t < i1) i1 = (int)t;
+            }
+            if (i0 > i1) return;
+        }
+
+        k = (int)(((int64_t)2 * db * i0 + da) / (2 * da));
+        di = 2 * db * (i0 + 1) - da - 2 * da * k;
+        a += a_sym * i0;
+        b += b_sym * k;
+        for (i = i0; ; i++) {
+            if (SWAP) r.plot(b, a);
+            else r.plot(a, b);
+            if (i == i1) break;
+            a += a_sym;
+            if (di < 0) {
+                di += 2 * db;
+            } else {
+                di += 2 * (db - da);
+                b += b_sym;
+            }
+        }
+    }
+};
+
+void C12832::line(int x0, int y0, int x1, int y1, int color)
+{
+    if (x0 == x1) {        /* vertical line */
+        if (y1 > y0) vline(x0,y0,y1,color);
+        else vline(x0,y1,y0,color);
+        update();
+        return;
+    }
+
+    if (y0 == y1) {        /* horizontal line */
+        if (x1 > x0) hline(x0,x1,y0,color);
+        else  hline(x1,x0,y0,color);
+        update();
+        return;
+    }
+
+    Clip clip = {clip_x0, clip_y0, clip_x1, clip_y1};
+    int c0 = clip.outcode(x0, y0);
+    int c1 = clip.outcode(x1, y1);
+    if (c0 & c1) return;   // both end points on the same outside: nothing to draw
+
+    LineOp op(x0, y0, x1, y1, clip, (c0 | c1) == 0);
+    dispatch(buffer, orientation, draw_mode, color, op);
+    mark_clipped(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0);
+    update();
+}
+
+void C12832::rect(int x0, int y0, int x1, int y1, int color)
+{
+    int i;
+    if(x0 > x1) {
+        i = x0;
+        x0 = x1;
+        x1 = i;
+    }
+
+    if(y0 > y1) {
+        i = y0;
+        y0 = y1;
+        y1 = i;
+    }
+
+    hline(x0,x1,y0,color);
+    if(y1 > y0) hline(x0,x1,y1,color);
+    if(y1 - y0 > 1) {             // sides without the corners, xor would clear them
+        vline(x0,y0+1,y1-1,color);
+        if(x1 > x0) vline(x1,y0+1,y1-1,color);
+    }
+    update();
+}
+
+void C12832::fillrect(int x0, int y0, int x1, int y1, int color)
+{
+    fill_area(x0,y0,x1,y1,color);
+    update();
+}
+
+void C12832::hline(int x0, int x1, int y, int color)
+{
+    fill_area(x0,y,x1,y,color);
+}
+
+void C12832::vline(int x, int y0, int y1, int color)
+{
+    fill_area(x,y0,x,y1,color);
+}
+
+// span operations on n bytes with the same mask
+// the mask is repeated to 32 bit to handle 4 columns at once
+
+enum {SPAN_CLEAR, SPAN_SET, SPAN_XOR};
+
+template <int OP> static inline uint32_t span_apply(uint32_t d, uint32_t m)
+{
+    if(OP == SPAN_CLEAR) return d & ~m;
+    if(OP == SPAN_SET) return d | m;
+    return d ^ m;
+}
+
+template <int OP> static void span(unsigned char* p, unsigned char mask, int n)
+{
+    uint32_t m = mask * 0x01010101UL;
+    uint32_t* w;
+
+    while(n > 0 && ((size_t)p & 3)) {     // up to the next word
+        *p = span_apply<OP>(*p, mask);
+        p++;
+        n--;
+    }
+    w = (uint32_t*)p;
+    while(n >= 4) {
+        *w = span_apply<OP>(*w, m);
+        w++;
+        n -= 4;
+    }
+    p = (unsigned char*)w;
+    while(n > 0) {
+        *p = span_apply<OP>(*p, mask);
+        p++;
+        n--;
+    }
+}
+
+void C12832::fill_area(int x0, int y0, int x1, int y1, int color)
+{
+    int i, page, p0, p1, n;
+    unsigned char mask;
+    unsigned char* p;
+
+    if(x0 > x1) {
+        i = x0;
+        x0 = x1;
+        x1 = i;
+    }
+    if(y0 > y1) {
+        i = y0;
+        y0 = y1;
+        y1 = i;
+    }
+    if(x0 < clip_x0) x0 = clip_x0;
+    if(y0 < clip_y0) y0 = clip_y0;
+    if(x1 > clip_x1) x1 = clip_x1;
+    if(y1 > clip_y1) y1 = clip_y1;
+    if(x0 > x1 || y0 > y1) return;
+    if(draw_mode != NORMAL && color != 1) return;   // xor with 0 changes nothing
+
+    // a rectangle stays a rectangle in every orientation
+    to_panel(x0, y0);
+    to_panel(x1, y1);
+    if(x0 > x1) {
+        i = x0;
+        x0 = x1;
+        x1 = i;
+    }
+    if(y0 > y1) {
+        i = y0;
+        y0 = y1;
+        y1 = i;
+    }
+
+    n = x1 - x0 + 1;
+    p0 = y0 >> 3;
+    p1 = y1 >> 3;
+    for(page = p0; page <= p1; page++) {
+        mask = 0xFF;
+        if(page == p0) mask &= 0xFF << (y0 & 7);        // top rows of first page
+        if(page == p1) mask &= 0xFF >> (7 - (y1 & 7));  // bottom rows of last page
+        p = &buffer[page * 128 + x0];
+        if(draw_mode != NORMAL) span<SPAN_XOR>(p, mask, n);
+        else if(color == 0) span<SPAN_CLEAR>(p, mask, n);
+        else span<SPAN_SET>(p, mask, n);
+        mark_dirty(page, x0, x1);
+    }
+}
+
+// clear the panel rows y0 .. y1 of the buffer
+
+void C12832::clear_rows(int y0, int y1)
+{
+    int page;
+    unsigned char mask;
+
+    for(page = y0 >> 3; page <= (y1 >> 3); page++) {
+        mask = 0xFF;
+        if(page == (y0 >> 3)) mask &= 0xFF << (y0 & 7);
+        if(page == (y1 >> 3)) mask &= 0xFF >> (7 - (y1 & 7));
+        span<SPAN_CLEAR>(&buffer[page * 128], mask, 128);
+        mark_dirty(page, 0, 127);
+    }
+}
+
+// landscape : the RAM of the controller holds 64 rows, the screen shows
+// 32 of them from the start line on. Scrolling moves the start line and
+// the framebuffer by the same rows, so only the new rows differ from
+// the RAM. Pending changes move with their rows.
+// portrait : the rows of the screen are columns of the panel,
+// the buffer is moved and sent completely, with the shadow only the changes.
+// 2 and 3 are turned by the controller and scroll like 0 and 1.
+
+// column spans of the pages moved with the rows, scrolled up by n
+
+static void move_spans(unsigned char* mn, unsigned char* mx, int n)
+{
+    unsigned char d0[4], d1[4];
+    int page, q, q0, q1;
+
+    for(page = 0; page < 4; page++) {
+        d0[page] = 128;
+        d1[page] = 0;
+        q0 = (8 * page + n + 64) / 8 - 8;
+        q1 = (8 * page + 7 + n + 64) / 8 - 8;
+        for(q = q0; q <= q1; q++) {
+            if(q < 0 || q > 3 || mn[q] > mx[q]) continue;
+            if(mn[q] < d0[page]) d0[page] = mn[q];
+            if(mx[q] > d1[page]) d1[page] = mx[q];
+        }
+    }
+    for(page = 0; page < 4; page++) {
+        mn[page] = d0[page];
+        mx[page] = d1[page];
+    }
+}
+
+void C12832::scroll(int n)
+{
+    PageBitmap fb = get_framebuffer();
+    int page, layered;
+
+    while(busy());     // the running pass uses the old start line
+    if(orientation == 0 || orientation == 2) {
+        n = -n;                       // screen up = panel right
+        if(n >= 128 || n <= -128) {
+            memset(buffer, 0x00, 512);
+        } else if(n > 0) {
+            bitblt(fb, 0, 0, fb, n, 0, 128 - n, 32, BLT_COPY);
+            for(page = 0; page < 4; page++) memset(&buffer[page * 128 + 128 - n], 0x00, n);
+        } else if(n < 0) {
+            bitblt(fb, -n, 0, fb, 0, 0, 128 + n, 32, BLT_COPY);
+            for(page = 0; page < 4; page++) memset(&buffer[page * 128], 0x00, -n);
+        }
+        for(page = 0; page < 4; page++) mark_dirty(page, 0, 127);   // the layer spans move too
+        update();
+        return;
+    }
+
+    if(n == 0) return;
+    if(n >= 32 || n <= -32) {
+        memset(buffer, 0x00, 512);
+        mark_all();
+        update();
+        return;
+    }
+
+    // the start line moves all layers, with more than the content
+    // shown only the rows of the layer drawn on are moved and sent
+#if C12832_LAYERS
+    layered = (draw_layer != LAYER_CONTENT || layer_shown != (1 << LAYER_CONTENT));
+#else
+    layered = 0;
+#endif
+    if(!layered) {
+        // dirty spans move with the rows, a pass takes them with the start line
+        __disable_irq();
+        scroll_line = (scroll_line + n) & 63;
+        move_spans(dirty_min, dirty_max, n);
+        __enable_irq();
+#if C12832_LAYERS
+        move_spans(layer_min[LAYER_CONTENT], layer_max[LAYER_CONTENT], n);
+#endif
+    }
+
+    if(n > 0) {
+        bitblt(fb, 0, 0, fb, 0, n, 128, 32 - n, BLT_COPY);
+        clear_rows(32 - n, 31);       // new rows, the RAM holds old ones
+    } else {
+        bitblt(fb, 0, -n, fb, 0, 0, 128, 32 + n, BLT_COPY);
+        clear_rows(0, -n - 1);
+    }
+    if(layered) {
+        for(page = 0; page < 4; page++) mark_dirty(page, 0, 127);
+    }
+    update();
+}
+
+#if C12832_TERMINAL
+// terminal mode
+// the text of the last lines is kept in a ring, TERM_COLS + 1 bytes a line
+
+void C12832::set_terminal(unsigned int lines)
+{
+    if(term_buf != NULL) delete[] term_buf;
+    term_buf = NULL;
+    term_lines = 0;
+    if(lines == 0) return;
+
+    term_buf = new char[lines * (TERM_COLS + 1)];
+    memset(term_buf, 0, lines * (TERM_COLS + 1));
+    term_lines = lines;
+    term_head = 0;
+    term_count = 1;
+    term_len = 0;
+    term_back = 0;
+    char_x = 0;
+    char_y = 0;
+    cls();
+}
+
+unsigned int C12832::get_terminal(void)
+{
+    return term_lines;
+}
+
+// next line, scroll up by one line at the bottom
+
+void C12832::term_newline(void)
+{
+    unsigned int mode = draw_mode;
+
+    term_head = (term_head + 1) % term_lines;
+    term_buf[term_head * (TERM_COLS + 1)] = 0;
+    term_len = 0;
+    if(term_count < term_lines) term_count++;
+
+    char_x = 0;
+    if((int)char_y + 2 * font_height() > height()) {
+        scroll(font_height());
+    } else {
+        char_y += font_height();
+    }
+    draw_mode = NORMAL;               // rows left below the last line
+    fill_area(0, char_y, width() - 1, char_y + font_height() - 1, 0);
+    draw_mode = mode;
+}
+
+void C12832::term_putc(int value)
+{
+    if(term_back) scroll_back(0);     // new text shows the newest lines
+    if(value == '\r') return;
+    if(value == '\n') {
+        term_newline();
+        update();
+        return;
+    }
+    if((int)char_x + font_width() > width() || term_len >= TERM_COLS) term_newline();
+    character(char_x, char_y, value);
+    term_buf[term_head * (TERM_COLS + 1) + term_len++] = value;
+    term_buf[term_head * (TERM_COLS + 1) + term_len] = 0;
+    update();
+}
+
+// redraw the terminal with the newest line n lines up from the bottom
+
+void C12832::scroll_back(unsigned int n)
+{
+    unsigned int rows, shown, i, line;
+    const char* t;
+
+    if(term_lines == 0) return;
+    if(n > term_count - 1) n = term_count - 1;
+    term_back = n;
+
+    rows = height() / font_height();
+    shown = term_count - n;
+    if(shown > rows) shown = rows;
+
+    memset(buffer, 0x00, 512);
+    mark_all();
+    for(i = 0; i < shown; i++) {
+        line = (term_head + term_lines * 2 - n - (shown - 1 - i)) % term_lines;
+        char_x = 0;
+        char_y = i * font_height();
+        for(t = &term_buf[line * (TERM_COLS + 1)]; *t; t++) {
+            character(char_x, char_y, *t);
+        }
+    }
+    update();
+}
+#endif
+
+
+
+#if C12832_SHAPES
+// midpoint circle, 8 octants
+// a circle inside the clip rectangle is drawn without checks
+
+struct CircleOp {
+    int x0, y0, r;
+    Clip clip;
+    int inside;
+    CircleOp(int x, int y, int rad, const Clip& c, int all) : x0(x), y0(y), r(rad), clip(c), inside(all) {}
+    template <class R> void operator()(R ras)
+    {
+        if (inside) draw<0>(ras);
+        else draw<1>(ras);
+    }
+
+    template <int CHECK, class R> inline void put(R ras, int x, int y)
+    {
+        if (!CHECK || clip.inside(x, y)) ras.plot(x, y);
+    }
+
+    template <int CHECK, class R> void draw(R ras)
+    {
+        int draw_x0, draw_y0;
+        int draw_x1, draw_y1;
+        int draw_x2, draw_y2;
+        int draw_x3, draw_y3;
+        int draw_x4, draw_y4;
+        int draw_x5, draw_y5;
+        int draw_x6, draw_y6;
+        int draw_x7, draw_y7;
+        int xx, yy;
+        int di;
+
+        draw_x0 = draw_x1 = x0;
+        draw_y0 = draw_y1 = y0 + r;
+        put<CHECK>(ras, draw_x0, draw_y0);     /* 90 degree */
+
+        draw_x2 = draw_x3 = x0;
+        draw_y2 = draw_y3 = y0 - r;
+        put<CHECK>(ras, draw_x2, draw_y2);     /* 270 degree */
+
+        draw_x4 = draw_x6 = x0 + r;
+        draw_y4 = draw_y6 = y0;
+        put<CHECK>(ras, draw_x4, draw_y4);     /* 0 degree */
+
+        draw_x5 = draw_x7 = x0 - r;
+        draw_y5 = draw_y7 = y0;
+        put<CHECK>(ras, draw_x5, draw_y5);     /* 180 degree */
+
+        if (r == 1) {
+            return;
+        }
+
+        di = 3 - 2*r;
+        xx = 0;
+        yy = r;
+        while (xx < yy) {
+
+            if (di < 0) {
+                di += 4*xx + 6;
+            } else {
+                di += 4*(xx - yy) + 10;
+                yy--;
+                draw_y0--;
+                draw_y1--;
+                draw_y2++;
+                draw_y3++;
+                draw_x4--;
+                draw_x5++;
+                draw_x6--;
+                draw_x7++;
+            }
+            xx++;
+            draw_x0++;
+            draw_x1--;
+            draw_x2++;
+            draw_x3--;
+            draw_y4++;
+            draw_y5++;
+            draw_y6--;
+            draw_y7--;
+
+            put<CHECK>(ras, draw_x0, draw_y0);
+            put<CHECK>(ras, draw_x1, draw_y1);
+            put<CHECK>(ras, draw_x2, draw_y2);
+            put<CHECK>(ras, draw_x3, draw_y3);
+            put<CHECK>(ras, draw_x4, draw_y4);
+            put<CHECK>(ras, draw_x5, draw_y5);
+            put<CHECK>(ras, draw_x6, draw_y6);
+            put<CHECK>(ras, draw_x7, draw_y7);
+        }
+    }
+};
+
+void C12832::circle(int x0, int y0, int r, int color)
+{
+    int a = (r < 0) ? -r : r;
+    Clip clip = {clip_x0, clip_y0, clip_x1, clip_y1};
+
+    if (r == 0) {       /* no radius */
+        return;
+    }
+    if (x0 + a < clip.x0 || x0 - a > clip.x1 || y0 + a < clip.y0 || y0 - a > clip.y1) {
+        return;         /* outside of the clip rectangle */
+    }
+
+    CircleOp op(x0, y0, r, clip, clip.inside(x0 - a, y0 - a) && clip.inside(x0 + a, y0 + a));
+    dispatch(buffer, orientation, draw_mode, color, op);
+    mark_clipped(x0 - a, y0 - a, x0 + a, y0 + a);
+    update();
+}
+
+void C12832::fillcircle(int x, int y, int r, int color)
+{
+    if (r < 0) return;
+    fill_round(x, y, x, y, r, color);
+    update();
+}
+
+void C12832::fillroundrect(int x0, int y0, int x1, int y1, int r, int color)
+{
+    int i;
+    if(x0 > x1) {
+        i = x0;
+        x0 = x1;
+        x1 = i;
+    }
+    if(y0 > y1) {
+        i = y0;
+        y0 = y1;
+        y1 = i;
+    }
+    if(r < 0) r = 0;
+    if(2 * r > x1 - x0) r = (x1 - x0) / 2;
+    if(2 * r > y1 - y0) r = (y1 - y0) / 2;
+    fill_round(x0 + r, y0 + r, x1 - r, y1 - r, r, color);
+    update();
+}
+
+// the rows of the corners follow the octant walk of circle(),
+// row t above / below the centre spans out to the outermost
+// outline pixel of that row. Row t gets its width from the
+// walk step xx = t (half width yy) or from the last step with
+// yy = t (half width xx), near 45 degree from both.
+
+void C12832::fill_round(int xl, int yt, int xr, int yb, int r, int color)
+{
+    int xx, yy, di, kmax, ymin, t;
+    int ov[2];
+
+    if(xr + r < clip_x0 || xl - r > clip_x1 || yb + r < clip_y0 || yt - r > clip_y1) return;
+
+    fill_area(xl - r, yt, xr + r, yb, color);   // rows between the corner centres
+
+    // first pass : end of the walk
+    di = 3 - 2*r;
+    xx = 0;
+    yy = r;
+    while (xx < yy) {
+        if (di < 0) {
+            di += 4*xx + 6;
+        } else {
+            di += 4*(xx - yy) + 10;
+            yy--;
+        }
+        xx++;
+    }
+    kmax = xx;                     // rows ymin .. kmax get their width from both
+    ymin = yy;
+    ov[0] = ov[1] = 0;
+
+    // second pass : emit each row once
+    di = 3 - 2*r;
+    xx = 0;
+    yy = r;
+    for (;;) {
+        if (xx < ymin) {
+            if (xx > 0) {
+                fill_area(xl - yy, yt - xx, xr + yy, yt - xx, color);
+                fill_area(xl - yy, yb + xx, xr + yy, yb + xx, color);
+            }
+        } else if (yy > ov[xx - ymin]) {
+            ov[xx - ymin] = yy;
+        }
+        if (yy <= kmax && xx > ov[yy - ymin]) ov[yy - ymin] = xx;
+        if (xx == kmax) break;
+
+        if (di < 0) {
+            di += 4*xx + 6;
+        } else {
+            di += 4*(xx - yy) + 10;
+            if (yy > kmax) {       // last step on row yy
+                fill_area(xl - xx, yt - yy, xr + xx, yt - yy, color);
+                fill_area(xl - xx, yb + yy, xr + xx, yb + yy, color);
+            }
+            yy--;
+        }
+        xx++;
+    }
+    for (t = ymin; t <= kmax; t++) {
+        if (t == 0) continue;
+        fill_area(xl - ov[t - ymin], yt - t, xr + ov[t - ymin], yt - t, color);
+        fill_area(xl - ov[t - ymin], yb + t, xr + ov[t - ymin], yb + t, color);
+    }
+}
+
+void C12832::filltriangle(int x0, int y0, int x1, int y1, int x2, int y2, int color)
+{
+    int x[3], y[3];
+    x[0] = x0;
+    y[0] = y0;
+    x[1] = x1;
+    y[1] = y1;
+    x[2] = x2;
+    y[2] = y2;
+    fillpolygon(x, y, 3, color);
+}
+
+// a / b rounded to the nearest integer, b > 0
+
+static inline int div_round(int64_t a, int64_t b)
+{
+    int64_t q;
+    a = 2 * a + b;
+    b = 2 * b;
+    q = a / b;
+    if (a % b < 0) q--;            // round down for negative a too
+    return (int)q;
+}
+
+// row y covers the band y - 1/2 .. y + 1/2, the part of an edge
+// inside the band gives the leftmost and rightmost pixel of the edge
+// on this row. Neighbour rows share the x at the band border, so the
+// spans of a row and the next one always touch.
+
+void C12832::fillpolygon(const int* x, const int* y, int n, int color)
+{
+    int i, j, row, top, bottom, xa, ya, xb, yb, s0, s1, u, v, lo, hi;
+
+    if (n < 1) return;
+    top = bottom = y[0];
+    for (i = 1; i < n; i++) {
+        if (y[i] < top) top = y[i];
+        if (y[i] > bottom) bottom = y[i];
+    }
+    if (top < clip_y0) top = clip_y0;           // only the rows inside the clip
+    if (bottom > clip_y1) bottom = clip_y1;
+
+    for (row = top; row <= bottom; row++) {
+        lo = 0x7FFFFFFF;
+        hi = -0x7FFFFFFF;
+        for (i = 0; i < n; i++) {
+            j = (i + 1 < n) ? i + 1 : 0;
+            if (y[i] <= y[j]) {
+                xa = x[i];
+                ya = y[i];
+                xb = x[j];
+                yb = y[j];
+            } else {
+                xa = x[j];
+                ya = y[j];
+                xb = x[i];
+                yb = y[i];
+            }
+            if (row < ya || row > yb) continue;
+            if (ya == yb) {                     // horizontal edge
+                u = xa;
+                v = xb;
+            } else {                            // in half pixel
+                s0 = (2*row - 1 > 2*ya) ? 2*row - 1 : 2*ya;
+                s1 = (2*row + 1 < 2*yb) ? 2*row + 1 : 2*yb;
+                u = xa + div_round((int64_t)(s0 - 2*ya) * (xb - xa), 2 * (yb - ya));
+                v = xa + div_round((int64_t)(s1 - 2*ya) * (xb - xa), 2 * (yb - ya));
+            }
+            if (u > v) {
+                j = u;
+                u = v;
+                v = j;
+            }
+            if (u < lo) lo = u;
+            if (v > hi) hi = v;
+        }
+        if (lo <= hi) fill_area(lo, row, hi, row, color);
+    }
+    update();
+}
+#endif
+
+void C12832::setmode(int mode)
+{
+    draw_mode = mode;
+}
+
+void C12832::locate(int x, int y)
+{
+    char_x = x;
+    char_y = y;
+}
+
+void C12832::get_locate(int& x, int& y)
+{
+    x = char_x;
+    y = char_y;
+}
+
+
+
+int C12832::columns()
+{
+    return width() / font_width();
+}
+
+
+
+int C12832::rows()
+{
+    return height() / font_height();
+}
+
+
+
+int C12832::_putc(int value)
+{
+#if C12832_TERMINAL
+    if (term_lines) {
+        term_putc(value);
+        return value;
+    }
+#endif
+    if (value == '\n') {    // new line
+        char_x = 0;
+        char_y = char_y + font_height();
+        if ((int)char_y >= height() - font_height()) {
+            char_y = 0;
+        }
+    } else {
+        character(char_x, char_y, value);
+        update();
+    }
+    return value;
+}
+
+// size of the char cell for both font formats
+
+int C12832::font_width()
+{
+    if (font[0] == PF_MAGIC) return font[PF_WIDTH];
+    return font[1];
+}
+
+int C12832::font_height()
+{
+    if (font[0] == PF_MAGIC) return font[PF_HEIGHT];
+    return font[2];
+}
+
+void C12832::character(int x, int y, int c)
+{
+    unsigned int hor,vert,offset,bpl,chars,off;
+    const unsigned char* zeichen;
+    unsigned char w;
+    int shifted;
+
+    if (font[0] == PF_MAGIC && font[1] == PF_PACKED) {
+#if C12832_PACKED_FONTS
+        // packed font, see PageFont.h
+        if ((c < font[PF_FIRST]) || (c > font[PF_LAST])) return;
+        hor = font[PF_WIDTH];
+        vert = font[PF_HEIGHT];
+        bpl = font[PF_STRIDE];
+        shifted = 0;
+        w = font[PF_HEADER + c - font[PF_FIRST]];
+        zeichen = packed_glyph(c);
+#else
+        return;                              // packed fonts are switched off
+#endif
+    } else if (font[0] == PF_MAGIC) {
+        // page font, see PageFont.h
+        if ((c < font[PF_FIRST]) || (c > font[PF_LAST])) return;
+        hor = font[PF_WIDTH];
+        vert = font[PF_HEIGHT];
+        bpl = font[PF_STRIDE];
+        chars = font[PF_LAST] - font[PF_FIRST] + 1;
+        off = y & 7;
+        shifted = (font[PF_VARIANTS] == 8) && (orientation & 1);   // pages are rows in landscape only
+        if (!shifted) off = 0;
+        w = font[PF_HEADER + c - font[PF_FIRST]];
+        zeichen = &font[PF_HEADER + chars + (off * chars + c - font[PF_FIRST]) * hor * bpl];
+    } else {
+        if ((c < 31) || (c > 127)) return;   // test char range
+
+        // read font parameter from start of array
+        offset = font[0];                    // bytes / char
+        hor = font[1];                       // get hor size of font
+        vert = font[2];                      // get vert size of font
+        bpl = font[3];                       // bytes per line
+        shifted = 0;
+
+        zeichen = &font[((c -32) * offset) + 4]; // start of char bitmap
+        w = zeichen[0];                          // width of actual char
+        zeichen++;
+    }
+
+    if ((int)(char_x + hor) > width()) {
+        char_x = 0;
+        char_y = char_y + vert;
+        if (char_y >= height() - vert) {
+            char_y = 0;
+        }
+    }
+
+    glyph(x, y, zeichen, bpl, hor, vert, shifted);
+    char_x += w;
+}
+
+// write the font columns of a char into the buffer
+// the font is stored column by column, bpl bytes per column,
+// bit 0 = top row. Each column is shifted to the page offset
+// and written with one masked byte per page, the masks and the
+// column range are cut to the clip rectangle first.
+// shifted = 1 : the columns are already moved down by y % 8 rows
+
+void C12832::glyph(int x, int y, const unsigned char* data, unsigned int bpl, unsigned int hor, unsigned int vert, int shifted)
+{
+    unsigned int i,j,pages,off,nbytes;
+    unsigned char* p;
+    unsigned char z;
+    unsigned char m[5];
+    uint32_t col,vmask;
+    int page,x0,x1,r0,r1,n,k;
+
+    if (!(orientation & 1)) {
+        glyph_portrait(x, y, data, bpl, hor, vert);
+        return;
+    }
+    if (vert > 32) vert = 32;
+    nbytes = (bpl > 4) ? 4 : bpl;             // bytes of a column in the word, bpl stays the stride
+    vmask = (vert == 32) ? 0xFFFFFFFFUL : ((1UL << vert) - 1);
+    page = (y >= 0) ? y / 8 : -((7 - y) / 8);  // page of the top row, rounded down
+    off = y - page * 8;                       // row offset inside this page
+    pages = (off + vert + 7) / 8;             // pages touched by the glyph
+    if (shifted && pages > bpl) pages = bpl;
+
+    x0 = x;
+    x1 = x + hor - 1;
+    if (x0 < clip_x0) x0 = clip_x0;
+    if (x1 > clip_x1) x1 = clip_x1;
+    if (x0 > x1) return;
+
+    for (j = 0; j < pages; j++) {             // rows of the glyph in each page
+        if (j == 0) m[j] = vmask << off;
+        else m[j] = vmask >> (8 * j - off);
+        r0 = clip_y0 - (page + (int)j) * 8;   // clip rows of this page
+        r1 = clip_y1 - (page + (int)j) * 8;
+        if (page + (int)j < 0 || page + (int)j > 3 || r0 > 7 || r1 < 0) m[j] = 0;
+        else {
+            if (r0 > 0) m[j] &= 0xFF << r0;
+            if (r1 < 7) m[j] &= 0xFF >> (7 - r1);
+        }
+    }
+
+    // one byte per column, like Font8x8_page or Small_7 :
+    // a whole cell on a page row is a copy of the columns,
+    // else each column is two masked bytes
+    if (bpl == 1 && !shifted) {
+        data += x0 - x;
+        n = x1 - x0 + 1;
+        if (m[0] == 0xFF && pages == 1 && vmask == 0xFF && draw_mode == NORMAL) {
+            memcpy(&buffer[page * 128 + x0], data, n);
+        } else {
+            for (k = 0; k < 2 && k < (int)pages; k++) {
+                if (m[k] == 0) continue;
+                p = &buffer[(page + k) * 128 + x0];
+                for (i = 0; i < (unsigned int)n; i++) {
+                    z = (k == 0) ? (data[i] & vmask) << off : (data[i] & vmask) >> (8 - off);
+                    if (draw_mode == NORMAL) p[i] = (p[i] & ~m[k]) | (z & m[k]);
+                    else p[i] ^= z & m[k];
+                }
+            }
+        }
+        for (j = 0; j < pages; j++) {
+            if (m[j] != 0) mark_dirty(page + j, x0, x1);
+        }
+        return;
+    }
+
+    for (i = x0 - x; i <= (unsigned int)(x1 - x); i++) {
+        if (!shifted) {
+            col = 0;
+            for (j = 0; j < nbytes; j++) {
+                col |= (uint32_t)data[bpl * i + j] << (8 * j);
+            }
+            col &= vmask;
+        }
+        p = &buffer[x + i];
+        for (j = 0; j < pages; j++) {
+            if (m[j] == 0) continue;
+            if (shifted) z = data[bpl * i + j];
+            else if (j == 0) z = col << off;
+            else z = col >> (8 * j - off);
+            if (draw_mode == NORMAL) {
+                p[(page + j) * 128] = (p[(page + j) * 128] & ~m[j]) | (z & m[j]);
+            } else {
+                p[(page + j) * 128] ^= z & m[j];
+            }
+        }
+    }
+    for (j = 0; j < pages; j++) {
+        if (m[j] != 0) mark_dirty(page + j, x0, x1);
+    }
+}
+
+
+// a panel column as one word, bit n = panel row n
+
+static inline uint32_t column_get(const unsigned char* buf, int c)
+{
+    return buf[c] | (buf[128 + c] << 8) | ((uint32_t)buf[256 + c] << 16) | ((uint32_t)buf[384 + c] << 24);
+}
+
+#if C12832_BITMAPS
+// change the rows in m of a panel column with a raster operation
+
+static void column_rop(unsigned char* buf, int c, uint32_t s, uint32_t m, int rop)
+{
+    unsigned char* p;
+    unsigned char bm, v;
+    int page;
+
+    for (page = 0; page < 4; page++, s >>= 8, m >>= 8) {
+        bm = m;
+        if (bm == 0) continue;
+        p = &buf[page * 128 + c];
+        v = s & bm;
+        switch (rop) {
+            case BLT_COPY:
+                *p = (*p & ~bm) | v;
+                break;
+            case BLT_OR:
+                *p |= v;
+                break;
+            case BLT_AND:
+                *p &= ~bm | v;
+                break;
+            case BLT_XOR:
+                *p ^= v;
+                break;
+            case BLT_NOT:
+                *p = (*p & ~bm) | (v ^ bm);
+                break;
+        }
+    }
+}
+#endif
+
+// portrait : screen x is the panel row, screen y the panel column 127 - y.
+// 8 columns of the char are turned into 8 rows at a time (transpose8()
+// of Blit.h), then the rows are written page by page, one masked byte
+// per panel column.
+
+void C12832::glyph_portrait(int x, int y, const unsigned char* data, unsigned int bpl, unsigned int hor, unsigned int vert)
+{
+    uint32_t row[32];                         // rows of the char, bit = screen x
+    uint32_t m;
+    unsigned char in[8], out[8];
+    unsigned char* p;
+    unsigned char bm;
+    unsigned int bytes;
+    int i, j, k, r, r0, r1, x0, x1, y0, y1;
+
+    if (vert > 32) vert = 32;
+    bytes = (vert + 7) / 8;
+    if (bytes > bpl) bytes = bpl;
+    x0 = x;
+    x1 = x + hor - 1;
+    y0 = y;
+    y1 = y + vert - 1;
+    if (x0 < clip_x0) x0 = clip_x0;
+    if (x1 > clip_x1) x1 = clip_x1;
+    if (y0 < clip_y0) y0 = clip_y0;
+    if (y1 > clip_y1) y1 = clip_y1;
+    if (x0 > x1 || y0 > y1) return;
+
+    // an unclipped 8x8 cell on a page of the panel : the turned bytes
+    // are its columns, like the copy in landscape
+    if (bpl == 1 && hor == 8 && vert == 8 && (x & 7) == 0 && x0 == x && x1 == x + 7
+            && y0 == y && y1 == y + 7 && draw_mode == NORMAL) {
+        transpose8(data, 1, out);
+        p = &buffer[(x >> 3) * 128 + 127 - y];
+        for (r = 0; r < 8; r++) p[-r] = out[r];
+        mark_dirty(x >> 3, 127 - y1, 127 - y0);
+        return;
+    }
+
+    for (r = 0; r < (int)vert; r++) row[r] = 0;
+    for (i = x0 - x; i <= x1 - x; i += 8) {
+        for (j = 0; j < (int)bytes; j++) {
+            if (i + 7 <= x1 - x) {
+                transpose8(&data[bpl * i + j], bpl, out);
+            } else {                          // last columns, the rest is empty
+                for (k = 0; k < 8; k++) in[k] = (i + k <= x1 - x) ? data[bpl * (i + k) + j] : 0;
+                transpose8(in, 1, out);
+            }
+            for (k = 0; k < 8 && 8 * j + k < (int)vert; k++) row[8 * j + k] |= (uint32_t)out[k] << (x + i);
+        }
+    }
+
+    m = (0xFFFFFFFFUL >> (31 - (x1 - x0))) << x0;   // screen x0 .. x1
+    r0 = y0 - y;
+    r1 = y1 - y;
+    for (k = x0 >> 3; k <= (x1 >> 3); k++) {
+        bm = m >> (8 * k);
+        p = &buffer[k * 128 + 127 - y];       // panel column of row 0
+        if (draw_mode == NORMAL) {
+            for (r = r0; r <= r1; r++) p[-r] = (p[-r] & ~bm) | ((row[r] >> (8 * k)) & bm);
+        } else {
+            for (r = r0; r <= r1; r++) p[-r] ^= (row[r] >> (8 * k)) & bm;
+        }
+        mark_dirty(k, 127 - y1, 127 - y0);
+    }
+}
+
+#if C12832_PACKED_FONTS
+// packed fonts
+// a glyph is cut to its used columns and rows, the first two bytes
+// give its size, the index points to every 16th glyph
+
+static inline unsigned int packed_size(const unsigned char* g)
+{
+    unsigned int cols = g[0] & 0x0F;
+    if (cols == 0) return 1;
+    return 2 + (cols * ((g[1] & 0x0F) + 1) + 7) / 8;
+}
+
+const unsigned char* C12832::packed_glyph(int c)
+{
+    GlyphEntry* e;
+    const unsigned char* index;
+    const unsigned char* g;
+    unsigned int i, j, k, n, r, bpl, chars, lead, cols, top, rows;
+    uint32_t col;
+    int victim;
+
+    glyph_tick++;
+    victim = 0;
+    for (i = 0; i < GLYPH_CACHE; i++) {
+        e = &glyph_cache[i];
+        if (e->used != 0 && e->font == font && e->c == c) {
+            e->used = glyph_tick;
+            return e->data;
+        }
+        if (e->used < glyph_cache[victim].used) victim = i;
+    }
+
+    // not in the cache : decode into the least recently used entry
+    bpl = font[PF_STRIDE];
+    chars = font[PF_LAST] - font[PF_FIRST] + 1;
+    k = c - font[PF_FIRST];
+    index = &font[PF_HEADER + chars];
+    g = index + 2 * ((chars + 15) / 16);
+    g += index[2 * (k / 16)] | (index[2 * (k / 16) + 1] << 8);
+    for (i = k & ~15U; i < k; i++) g += packed_size(g);
+
+    e = &glyph_cache[victim];
+    memset(e->data, 0x00, font[PF_WIDTH] * bpl);
+    lead = g[0] >> 4;
+    cols = g[0] & 0x0F;
+    if (cols != 0) {
+        top = g[1] >> 4;
+        rows = (g[1] & 0x0F) + 1;
+        g += 2;
+        n = 0;
+        for (i = 0; i < cols; i++) {
+            col = 0;
+            for (r = 0; r < rows; r++, n++) {
+                if (g[n >> 3] & (1 << (n & 7))) col |= 1UL << r;
+            }
+            col <<= top;
+            for (j = 0; j < bpl; j++) e->data[(lead + i) * bpl + j] = col >> (8 * j);
+        }
+    }
+    e->font = font;
+    e->c = c;
+    e->used = glyph_tick;
+    glyph_decodes++;
+    return e->data;
+}
+
+unsigned int C12832::get_glyph_decodes(void)
+{
+    return glyph_decodes;
+}
+#endif
+
+void C12832::set_font(unsigned char* f)
+{
+    font = f;
+}
+
+int C12832::char_width(int c)
+{
+    if (font[0] == PF_MAGIC) {
+        if ((c < font[PF_FIRST]) || (c > font[PF_LAST])) return 0;
+        return font[PF_HEADER + c - font[PF_FIRST]];
+    }
+    if ((c < 32) || (c > 127)) return 0;
+    return font[((c - 32) * font[0]) + 4];
+}
+
+#if C12832_AUTO_UP
+void C12832::set_auto_up(unsigned int up)
+{
+    if(up ) auto_up = 1;
+    else auto_up = 0;
+}
+
+unsigned int C12832::get_auto_up(void)
+{
+    return (auto_up);
+}
+#endif
+
+void C12832::update(void)
+{
+#if C12832_AUTO_UP
+    if(auto_up && frame_depth == 0) copy_to_lcd();
+#endif
+}
+
+void C12832::begin_frame(void)
+{
+    frame_depth++;
+}
+
+void C12832::end_frame(void)
+{
+    if(frame_depth == 0) return;
+    frame_depth--;
+    update();
+}
+
+unsigned int C12832::get_flush_count(void)
+{
+    return flush_count;
+}
+
+// printf of Stream calls _putc for every char,
+// format the string first and draw it as one frame
+
+int C12832::printf(const char* format, ...)
+{
+    char buf[64];
+    char* s = buf;
+    va_list arg;
+    int n, i;
+
+    va_start(arg, format);
+    n = vsnprintf(buf, sizeof(buf), format, arg);
+    va_end(arg);
+    if(n < 0) return n;
+    if(n >= (int)sizeof(buf)) {          // does not fit, format again on the heap
+        s = new char[n + 1];
+        va_start(arg, format);
+        vsnprintf(s, n + 1, format, arg);
+        va_end(arg);
+    }
+
+    begin_frame();
+    for(i = 0; i < n; i++) {
+        _putc(s[i]);
+    }
+    end_frame();
+
+    if(s != buf) delete[] s;
+    return n;
+}
+
+#if C12832_BITMAPS
+void C12832::print_bm(const Bitmap& bm, int x, int y)
+{
+    blit(bm, 0, 0, bm.xSize, bm.ySize, x, y, draw_mode == XOR ? BLT_XOR : BLT_COPY);
+}
+
+#if C12832_PACKED_FONTS
+void C12832::print_bm(const PackedBitmap& bm, int x, int y)
+{
+    PageBitmap strip;
+    unsigned char page[128];
+    const unsigned char* p = bm.data;
+    int k, h;
+
+    if (bm.width > 128) return;
+    strip.width = bm.width;
+    strip.height = 8;
+    strip.data = page;
+    begin_frame();
+    for (k = 0; 8 * k < bm.height; k++) {
+        p = unpack_page(p, page, bm.width);
+        h = bm.height - 8 * k;
+        if (h > 8) h = 8;
+        blit(strip, 0, 0, bm.width, h, x, y + 8 * k, draw_mode == XOR ? BLT_XOR : BLT_COPY);
+    }
+    end_frame();
+}
+#endif
+
+// w pixel of a source row as one word, bit 0 = left pixel
+
+static uint32_t row_bits(const Bitmap& bm, int x, int y, int w)
+{
+    const unsigned char* p = (const unsigned char*)bm.data + bm.Byte_in_Line * y;
+    uint32_t r = 0;
+    int i;
+
+    for(i = 0; i < w; i++) r |= (uint32_t)((p[(x + i) >> 3] >> (7 - ((x + i) & 7))) & 1) << i;
+    return r;
+}
+
+static uint32_t row_bits(const PageBitmap& bm, int x, int y, int w)
+{
+    const unsigned char* p = bm.data + (y >> 3) * bm.width + x;
+    uint32_t r = 0;
+    int i;
+
+    for(i = 0; i < w; i++) r |= (uint32_t)((p[i] >> (y & 7)) & 1) << i;
+    return r;
+}
+
+// cut to the clip rectangle, then whole bytes in landscape,
+// in portrait a row of the source is one word in a panel column
+
+template <class B> void C12832::blit_screen(const B& src, int sw, int sh, int sx, int sy, int w, int h, int x, int y, int rop)
+{
+    uint32_t m;
+    int v0;
+
+    if(!blit_clip(clip_x0, clip_y0, clip_x1, clip_y1, sw, sh, x, y, sx, sy, w, h)) return;
+    if(orientation & 1) {
+        bitblt(get_framebuffer(), x, y, src, sx, sy, w, h, rop);
+    } else {
+        m = (0xFFFFFFFFUL >> (32 - w)) << x;    // w <= 32 after the clip
+        for(v0 = 0; v0 < h; v0++) {
+            column_rop(buffer, 127 - (y + v0), row_bits(src, sx, sy + v0, w) << x, m, rop);
+        }
+    }
+    mark_area(x, y, x + w - 1, y + h - 1);
+    update();
+}
+
+void C12832::blit(const Bitmap& src, int sx, int sy, int w, int h, int x, int y, int rop)
+{
+    blit_screen(src, src.xSize, src.ySize, sx, sy, w, h, x, y, rop);
+}
+
+void C12832::blit(const PageBitmap& src, int sx, int sy, int w, int h, int x, int y, int rop)
+{
+    blit_screen(src, src.width, src.height, sx, sy, w, h, x, y, rop);
+}
+
+// whole bytes in landscape, a panel column for each row in portrait
+
+void C12832::get_area(const PageBitmap& dst, int x, int y, int w, int h)
+{
+    uint32_t col;
+    unsigned char* p;
+    int h0, v0, px, py;
+    unsigned char m;
+
+    if(orientation & 1) {
+        bitblt(dst, 0, 0, get_framebuffer(), x, y, w, h, BLT_COPY);
+        return;
+    }
+    for(v0 = 0; v0 < h && v0 < dst.height; v0++) {
+        py = y + v0;
+        if(py < 0 || py >= 128) continue;
+        col = column_get(buffer, 127 - py);
+        p = &dst.data[(v0 >> 3) * dst.width];
+        m = 1 << (v0 & 7);
+        for(h0 = 0; h0 < w && h0 < dst.width; h0++) {
+            px = x + h0;
+            if(px < 0 || px >= 32) continue;
+            if((col >> px) & 1) p[h0] |= m;
+            else p[h0] &= ~m;
+        }
+    }
+}
+
+// bulk operations of GraphicsDisplay
+// the defaults of the base class call pixel() for every pixel,
+// here they go to fill_area() and blit() on whole bytes
+
+void C12832::fill(int x, int y, int w, int h, int colour)
+{
+    if(w <= 0 || h <= 0) return;
+    fill_area(x, y, x + w - 1, y + h - 1, colour != 0);
+    update();
+}
+
+void C12832::fill_span(int x0, int x1, int y, int colour)
+{
+    fill_area(x0, y, x1, y, colour != 0);
+    update();
+}
+
+void C12832::blit_native(int x, int y, int w, int h, const unsigned char* data)
+{
+    PageBitmap src;
+
+    src.width = w;
+    src.height = h;
+    src.data = (unsigned char*)data;
+    blit(src, 0, 0, w, h, x, y, draw_mode == XOR ? BLT_XOR : BLT_COPY);
+}
+
+// one row bitmap per row, up to 128 pixel at a time
+
+void C12832::blit(int x, int y, int w, int h, const int* colour)
+{
+    unsigned char row[16];
+    Bitmap bm;
+    int r, c, c0, n;
+
+    bm.ySize = 1;
+    bm.Byte_in_Line = 16;
+    bm.data = (char*)row;
+    begin_frame();
+    for(r = 0; r < h; r++) {
+        for(c0 = 0; c0 < w; c0 += 128) {
+            n = (w - c0 < 128) ? w - c0 : 128;
+            memset(row, 0x00, sizeof(row));
+            for(c = 0; c < n; c++) {
+                if(colour[r * w + c0 + c]) row[c >> 3] |= 0x80 >> (c & 7);
+            }
+            bm.xSize = n;
+            blit(bm, 0, 0, n, 1, x + c0, y + r, draw_mode == XOR ? BLT_XOR : BLT_COPY);
+        }
+    }
+    end_frame();
+}
+
+void C12832::blitbit(int x, int y, int w, int h, const char* colour)
+{
+    int fg = (_foreground != 0);
+    int bg = (_background != 0);
+
+    if(w <= 0 || h <= 0) return;
+    if(fg == bg) {                    // no picture, only the background
+        fill(x, y, w, h, fg);
+    } else if(draw_mode == XOR) {     // the bits of colour 1 toggle
+        begin_frame();
+        if(bg) fill(x, y, w, h, 1);   // d ^ !s = d ^ 1 ^ s
+        blit_stream(x, y, w, h, (const unsigned char*)colour, BLT_XOR);
+        end_frame();
+    } else {
+        blit_stream(x, y, w, h, (const unsigned char*)colour, fg ? BLT_COPY : BLT_NOT);
+    }
+}
+
+// rows of a multiple of 8 pixel are a Bitmap already,
+// else each row is moved to the start of a byte first
+
+void C12832::blit_stream(int x, int y, int w, int h, const unsigned char* bits, int rop)
+{
+    unsigned char row[16];
+    Bitmap bm;
+    int r, k, c0, n, b, last;
+
+    if((w & 7) == 0) {
+        bm.xSize = w;
+        bm.ySize = h;
+        bm.Byte_in_Line = w >> 3;
+        bm.data = (char*)bits;
+        blit(bm, 0, 0, w, h, x, y, rop);
+        return;
+    }
+    last = (w * h - 1) >> 3;          // last byte of the stream
+    bm.ySize = 1;
+    bm.Byte_in_Line = 16;
+    bm.data = (char*)row;
+    begin_frame();
+    for(r = 0; r < h; r++) {
+        for(c0 = 0; c0 < w; c0 += 128) {
+            n = (w - c0 < 128) ? w - c0 : 128;
+            for(k = 0; k < (n + 7) >> 3; k++) {
+                b = r * w + c0 + 8 * k;
+                row[k] = bits[b >> 3] << (b & 7);
+                if((b & 7) && (b >> 3) < last) row[k] |= bits[(b >> 3) + 1] >> (8 - (b & 7));
+            }
+            bm.xSize = n;
+            blit(bm, 0, 0, n, 1, x + c0, y + r, rop);
+        }
+    }
+    end_frame();
+}
+#endif
+
+PageBitmap C12832::get_framebuffer(void)
+{
+    PageBitmap fb;
+    fb.width = 128;
+    fb.height = 32;
+    fb.data = buffer;
+    return fb;
+}
@@ -0,0 +1,940 @@
+/* mbed library for the mbed Lab Board  128*32 pixel LCD
+ * use C12832 controller
+ * Copyright (c) 2012 Peter Drescher - DC2PD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef C12832_H
+#define C12832_H
+
+#include "mbed.h"
+#include "C12832_config.h"
+#include "GraphicsDisplay.h"
+#include "Blit.h"
+#include "SPIBus.h"
+
+
+/** optional Defines :
+  * #define debug_lcd  1  enable infos to PC_USB
+  */
+
+/** optional Defines :
+  * on TARGET_STM32F4 flush_async() streams the pages through the
+  * SPI TX DMA stream (SPI1: DMA2 stream 3, SPI2: DMA1 stream 4,
+  * SPI3: DMA1 stream 5), on other targets it falls back to copy_to_lcd()
+  */
+
+/** optional Defines :
+  * parts of the library can be switched off, see C12832_config.h
+  */
+#define GLYPH_BYTES  32   // columns * bytes per column of a decoded glyph, up to 15 x 16 pixel
+
+/** Draw mode
+  * NORMAl
+  * XOR set pixel by xor the screen
+  */
+enum {NORMAL,XOR};
+
+/** Layers
+  * LAYER_BACKGROUND static picture, hidden after reset
+  * LAYER_CONTENT    normal drawing, shown after reset
+  * LAYER_OVERLAY    cursor, highlight or banner, hidden after reset
+  *
+  * the shown layers are put together from the background up
+  * when the lcd is updated
+  */
+enum {LAYER_BACKGROUND, LAYER_CONTENT, LAYER_OVERLAY};
+
+/** rule to put a layer on the layers below
+  * LAYER_OR   set pixel are set
+  * LAYER_XOR  set pixel invert the layers below
+  * LAYER_MASK set pixel clear the layers below
+  */
+enum {LAYER_OR, LAYER_XOR, LAYER_MASK};
+
+class C12832 : public GraphicsDisplay
+{
+public:
+    /** Create a C12832 object connected to SPI1
+      *
+      */
+
+    C12832(PinName mosi, PinName sck, PinName reset, PinName a0, PinName ncs, const char* name = "LCD");
+
+    /** Create a C12832 object on a shared SPI bus
+      *
+      * the bus can hold more panels and other devices, see SPIBus.h
+      *
+      * @param bus SPI bus, 8 bit mode 3 and 20 MHz are set for the panel
+      * @param reset,a0,ncs pins of the panel
+      */
+    C12832(SPIBus& bus, PinName reset, PinName a0, PinName ncs, const char* name = "LCD");
+
+    ~C12832();
+
+
+    /** Get the width of the screen in pixel
+      *
+      * @param
+      * @returns width of screen in pixel
+      *
+      */
+    virtual int width();
+
+    /** Get the height of the screen in pixel
+     *
+     * @returns height of screen in pixel
+     *
+     */
+    virtual int height();
+
+    /** Draw a pixel at x,y black or white
+     *
+     * @param x horizontal position
+     * @param y vertical position
+     * @param colour ,1 set pixel ,0 erase pixel
+     */
+    virtual void pixel(int x, int y,int colour);
+
+#if C12832_SHAPES
+    /** draw a circle
+      *
+      * @param x0,y0 center
+      * @param r radius
+      * @param colour ,1 set pixel ,0 erase pixel
+      *
+      */
+    void circle(int x, int y, int r, int colour);
+
+    /** draw a filled circle
+     *
+     * @param x0,y0 center
+     * @param r radius
+     * @param color ,1 set pixel ,0 erase pixel
+     *
+     * filled row by row, the outline is the same as circle()
+     */
+    void fillcircle(int x, int y, int r, int colour);
+#endif
+
+    /** draw a 1 pixel line
+      *
+      * @param x0,y0 start point
+      * @param x1,y1 stop point
+      * @param color ,1 set pixel ,0 erase pixel
+      *
+      */
+    void line(int x0, int y0, int x1, int y1, int colour);
+
+    /** draw a rect
+    *
+    * @param x0,y0 top left corner
+    * @param x1,y1 down right corner
+    * @param color 1 set pixel ,0 erase pixel
+    *                                                   *
+    */
+    void rect(int x0, int y0, int x1, int y1, int colour);
+
+    /** draw a filled rect
+      *
+      * @param x0,y0 top left corner
+      * @param x1,y1 down right corner
+      * @param color 1 set pixel ,0 erase pixel
+      *
+      */
+    void fillrect(int x0, int y0, int x1, int y1, int colour);
+
+#if C12832_SHAPES
+    /** draw a filled rect with round corners
+      *
+      * @param x0,y0 top left corner
+      * @param x1,y1 down right corner
+      * @param r radius of the corners, limited to half the size
+      * @param color 1 set pixel ,0 erase pixel
+      *
+      */
+    void fillroundrect(int x0, int y0, int x1, int y1, int r, int colour);
+
+    /** draw a filled triangle
+      *
+      * @param x0,y0 first corner
+      * @param x1,y1 second corner
+      * @param x2,y2 third corner
+      * @param color 1 set pixel ,0 erase pixel
+      *
+      */
+    void filltriangle(int x0, int y0, int x1, int y1, int x2, int y2, int colour);
+
+    /** draw a filled convex polygon
+      *
+      * @param x,y arrays of the corners, in order around the polygon
+      * @param n number of corners
+      * @param color 1 set pixel ,0 erase pixel
+      *
+      * each row is filled from the leftmost to the rightmost edge,
+      * a concave polygon is filled like its outline was convex per row
+      */
+    void fillpolygon(const int* x, const int* y, int n, int colour);
+#endif
+
+    /** set the clip rectangle
+      *
+      * pixel outside the rectangle are not changed by the drawing
+      * functions, cls() still clears the whole screen.
+      * The rectangle is limited to the screen.
+      *
+      * @param x0,y0 top left corner
+      * @param x1,y1 down right corner
+      */
+    void set_clip(int x0, int y0, int x1, int y1);
+
+    /** draw on the whole screen again
+      *
+      */
+    void reset_clip(void);
+
+    /** get the clip rectangle
+      *
+      * @param x0,y0 top left corner
+      * @param x1,y1 down right corner
+      */
+    void get_clip(int& x0, int& y0, int& x1, int& y1);
+
+    /** copy display buffer to lcd
+      *
+      * only the columns changed since the last update are sent,
+      * clean pages are skipped completely
+      */
+
+    void copy_to_lcd(void);
+
+    /** mark the whole display buffer as changed
+      *
+      * the next copy_to_lcd() will send all 4 pages,
+      * also the bytes the lcd should show already
+      */
+    void invalidate(void);
+
+    /** get the number of bytes sent by the last copy_to_lcd()
+      *
+      * a pass of flush_async() by DMA is counted while it runs
+      *
+      * @returns command and data bytes written to the controller
+      */
+    unsigned int get_bytes_sent(void);
+
+    /** get the number of bytes saved by the last copy_to_lcd()
+      *
+      * @returns bytes not sent compared to a full refresh (4 * (3 + 128))
+      */
+    unsigned int get_bytes_saved(void);
+
+    /** start a non blocking update of the lcd
+      *
+      * the dirty pages are sent by DMA, A0 is switched between
+      * the command and data phase in the DMA interrupt.
+      * Drawing is allowed while the transfer is running,
+      * changed columns are sent by the next update.
+      * If called while busy a second pass is started at the end.
+      *
+      * Without DMA the update is sent at once. Called from an interrupt
+      * it does not wait for the bus : the update is sent at once if the
+      * bus is free, else when the device that has it gives it back.
+      */
+    void flush_async(void);
+
+    /** check if an asynchronous update is running
+      *
+      * @returns true while flush_async() is sending data or waits for the bus
+      */
+    bool busy(void);
+
+    /** attach a function called when flush_async() has finished
+      *
+      * @param func callback, called from interrupt context
+      */
+    void attach_flush_done(Callback<void()> func);
+
+    /** scroll the screen up
+      *
+      * in landscape the start line register of the controller moves
+      * the picture, the next update only sends the n new rows.
+      * The new rows are cleared, the clip rectangle is not used.
+      *
+      * @param n rows, < 0 scrolls down
+      */
+    void scroll(int n);
+
+#if C12832_TERMINAL
+    /** switch the terminal mode on or off
+      *
+      * text is written line by line, a new line at the bottom
+      * scrolls the screen up by one line. The text of the last
+      * lines is kept in a ring for scroll_back().
+      *
+      * @param lines lines in the ring, 0 = off
+      */
+    void set_terminal(unsigned int lines);
+
+    /** get the size of the terminal ring
+      *
+      * @returns lines in the ring, 0 = terminal mode off
+      */
+    unsigned int get_terminal(void);
+
+    /** show older lines of the terminal
+      *
+      * the next char printed shows the newest lines again
+      *
+      * @param n lines back, 0 = newest
+      */
+    void scroll_back(unsigned int n);
+#endif
+
+#if C12832_LAYERS
+    /** select the layer to draw on
+      *
+      * all drawing functions, cls() and scroll() work on this layer.
+      * The memory of the background and overlay layer is taken
+      * at the first use.
+      *
+      * @param layer LAYER_BACKGROUND, LAYER_CONTENT or LAYER_OVERLAY
+      */
+    void select_layer(int layer);
+
+    /** get the layer drawn on
+      *
+      * @returns LAYER_BACKGROUND, LAYER_CONTENT or LAYER_OVERLAY
+      */
+    int get_layer(void);
+
+    /** show or hide a layer
+      *
+      * the layer underneath is not drawn again, the next update
+      * sends the columns the layer has been drawn on
+      *
+      * @param layer LAYER_BACKGROUND, LAYER_CONTENT or LAYER_OVERLAY
+      * @param on 1 = show, 0 = hide
+      */
+    void show_layer(int layer, unsigned int on);
+
+    /** set the rule to put a layer on the layers below
+      *
+      * @param layer LAYER_BACKGROUND, LAYER_CONTENT or LAYER_OVERLAY
+      * @param rule LAYER_OR, LAYER_XOR or LAYER_MASK
+      */
+    void set_layer_rule(int layer, int rule);
+#endif
+
+    /** set the orientation of the screen
+      *
+      * @param o 0 portrait, 1 landscape (after reset),
+      *          2 portrait and 3 landscape turned by 180 degree
+      *
+      * 2 and 3 are turned by the segment and common direction of the
+      * controller, the buffer keeps the layout of 0 and 1. The clip
+      * rectangle is reset and the buffer is sent again. The picture is
+      * kept, after a change between landscape and portrait draw again.
+      */
+    void set_orientation(unsigned int o);
+
+    /** get the orientation of the screen
+      *
+      */
+    unsigned int get_orientation(void);
+
+
+    void set_contrast(unsigned int o);
+
+    /** read the contrast level
+      *
+      */
+    unsigned int get_contrast(void);
+
+
+    /** invert the screen
+      *
+      * @param o = 0 normal, 1 invert
+      */
+    void invert(unsigned int o);
+
+    /** clear the screen
+       *
+       * the lcd is updated like by the drawing functions, in a frame
+       * only once at its end
+       */
+    virtual void cls(void);
+
+    /** set the drawing mode
+      *
+      * @param mode NORMAl or XOR
+      */
+
+    void setmode(int mode);
+
+    virtual int columns(void);
+
+    /** calculate the max number of columns
+     *
+     * @returns max column
+     * depends on actual font size
+     *
+     */
+    virtual int rows(void);
+
+    /** put a char on the screen
+     *
+     * @param value char to print
+     * @returns printed char
+     *
+     */
+    virtual int _putc(int value);
+
+    /** draw a character on given position out of the active font to the LCD
+     *
+     * @param x x-position of char (top left)
+     * @param y y-position
+     * @param c char to print
+     *
+     */
+    virtual void character(int x, int y, int c);
+
+    /** setup cursor position
+     *
+     * @param x x-position (top left)
+     * @param y y-position
+     */
+    virtual void locate(int x, int y);
+
+    /** get the cursor position
+     *
+     * @param x,y position of the next char, set by locate()
+     */
+    void get_locate(int& x, int& y);
+    
+#if C12832_AUTO_UP
+    /** setup auto update of screen 
+      *
+      * @param up 1 = on , 0 = off
+      * if switched off the program has to call copy_to_lcd() 
+      * to update screen from framebuffer
+      */
+    void set_auto_up(unsigned int up);
+
+    /** get status of the auto update function
+      *
+      *  @returns if auto update is on
+      */
+    unsigned int get_auto_up(void);
+#endif
+
+    /** start a frame
+      *
+      * the auto update is suspended until the matching end_frame(),
+      * frames can be nested
+      */
+    void begin_frame(void);
+
+    /** end a frame
+      *
+      * the outermost end_frame() updates the lcd once
+      * if auto update is on
+      */
+    void end_frame(void);
+
+    /** get the number of lcd updates
+      *
+      * @returns number of copy_to_lcd() / flush_async() passes since reset
+      */
+    unsigned int get_flush_count(void);
+
+    /** frame for the lifetime of a scope
+      *
+      * @code
+      * {
+      *     C12832::Frame frame(lcd);
+      *     lcd.locate(0,0);
+      *     lcd.printf("%02d:%02d", min, sec);
+      * }   // one update here
+      * @endcode
+      */
+    class Frame
+    {
+    public:
+        Frame(C12832& lcd) : _lcd(lcd) {
+            _lcd.begin_frame();
+        }
+        ~Frame() {
+            _lcd.end_frame();
+        }
+    private:
+        C12832& _lcd;
+    };
+
+    /** print a formatted string
+      *
+      * the whole string is drawn as one frame. This hides the printf of
+      * Stream, it is not virtual : through a Stream& or TextDisplay&,
+      * or by claim(stdout), every char is still updated on its own, put
+      * such output in a Frame or begin_frame() / end_frame().
+      *
+      * @param format printf format string
+      * @returns number of characters printed
+      */
+    int printf(const char* format, ...);
+
+    /** Vars     */
+    DigitalOut _reset;
+    DigitalOut _A0;
+    DigitalOut _CS;
+    unsigned char* font;
+    unsigned int draw_mode;
+
+
+    /** select the font to use
+      *
+      * @param f pointer to font array
+      *
+      *   font array can created with GLCD Font Creator from http://www.mikroe.com
+      *   you have to add 4 parameter at the beginning of the font array to use:
+      *   - the number of byte / char
+      *   - the vertial size in pixel
+      *   - the horizontal size in pixel
+      *   - the number of byte per vertical line
+      *   you also have to change the array to char[]
+      *
+      *   page fonts and packed fonts made by tools/fontconv are
+      *   accepted as well, see PageFont.h
+      *
+      */
+    void set_font(unsigned char* f);
+
+#if C12832_PACKED_FONTS
+    /** get the number of glyphs decoded from packed fonts
+      *
+      * a glyph found in the cache is not counted
+      *
+      * @returns glyphs decoded since reset
+      */
+    unsigned int get_glyph_decodes(void);
+#endif
+
+    /** get the advance of a char in the active font
+      *
+      * @param c char
+      * @returns pixel from this char to the next one, 0 if not in the font
+      */
+    int char_width(int c);
+    
+#if C12832_BITMAPS
+    /** print bitmap to buffer
+      *
+      * @param bm Bitmap in flash
+      * @param x  x start
+      * @param y  y start 
+      *
+      * NORMAL copies the bitmap, XOR inverts the set pixel
+      */
+
+    void print_bm(const Bitmap& bm, int x, int y);
+
+#if C12832_PACKED_FONTS
+    /** print a packed bitmap to buffer
+      *
+      * unpacked page by page, see PackedBitmap in Blit.h
+      *
+      * @param bm packed bitmap in flash
+      * @param x  x start
+      * @param y  y start
+      */
+    void print_bm(const PackedBitmap& bm, int x, int y);
+#endif
+
+    /** copy a rectangle of a bitmap to the screen
+      *
+      * @param src bitmap, row layout (Bitmap) or page layout (PageBitmap)
+      * @param sx,sy top left corner in the bitmap
+      * @param w,h size
+      * @param x,y position on the screen
+      * @param rop BLT_COPY, BLT_OR, BLT_AND, BLT_XOR or BLT_NOT
+      *
+      */
+    void blit(const Bitmap& src, int sx, int sy, int w, int h, int x, int y, int rop);
+    void blit(const PageBitmap& src, int sx, int sy, int w, int h, int x, int y, int rop);
+
+    /** copy a rectangle of the screen to a page bitmap
+      *
+      * the reverse of blit(), pixel outside the screen are not changed
+      *
+      * @param dst bitmap, the rectangle goes to its top left corner
+      * @param x,y top left corner on the screen
+      * @param w,h size
+      */
+    void get_area(const PageBitmap& dst, int x, int y, int w, int h);
+
+    /** bulk operations of GraphicsDisplay on the page buffer
+      *
+      * one update per call, a colour != 0 sets the pixel.
+      * blitbit draws the set bits in the foreground colour and the
+      * others in the background colour.
+      */
+    virtual void fill(int x, int y, int w, int h, int colour);
+    virtual void fill_span(int x0, int x1, int y, int colour);
+    virtual void blit(int x, int y, int w, int h, const int* colour);
+    virtual void blitbit(int x, int y, int w, int h, const char* colour);
+    virtual void blit_native(int x, int y, int w, int h, const unsigned char* data);
+#endif
+
+    /** get the framebuffer as page bitmap
+      *
+      * the framebuffer of the selected layer, in the panel layout, 128 x 32.
+      * Use it as source of bitblt() to save a part of the screen,
+      * call invalidate() after writing to it directly.
+      *
+      * @returns bitmap of the framebuffer
+      */
+    PageBitmap get_framebuffer(void);
+
+protected:
+
+    /** draw a horizontal line
+      *
+      * @param x0 horizontal start
+      * @param x1 horizontal stop
+      * @param y vertical position
+      * @param ,1 set pixel ,0 erase pixel
+      *
+      */
+    void hline(int x0, int x1, int y, int colour);
+
+    /** draw a vertical line
+     *
+     * @param x horizontal position
+     * @param y0 vertical start
+     * @param y1 vertical stop
+     * @param ,1 set pixel ,0 erase pixel
+     */
+    void vline(int x, int y0, int y1, int colour);
+
+    /** fill a rectangle in the buffer, no update
+     *
+     * works page by page on whole bytes with masks for the
+     * top and bottom page, 4 columns at once where aligned
+     *
+     * @param x0,y0 top left corner
+     * @param x1,y1 down right corner
+     * @param colour 1 set pixel ,0 erase pixel
+     */
+    void fill_area(int x0, int y0, int x1, int y1, int colour);
+
+#if C12832_SHAPES
+    /** fill a rectangle with round corners, no update
+     *
+     * the rows of the corners are spans from the midpoint circle,
+     * each row is filled once
+     *
+     * @param xl,yt center of the top left corner circle
+     * @param xr,yb center of the down right corner circle
+     * @param r radius
+     * @param colour 1 set pixel ,0 erase pixel
+     */
+    void fill_round(int xl, int yt, int xr, int yb, int r, int colour);
+#endif
+
+    /** set up the object and the controller, for both constructors
+     *
+     */
+    void init(SPIBus& bus);
+
+    /** Init the C12832 LCD controller
+     *
+     */
+    void lcd_reset();
+
+    /** Write data to the LCD controller
+     *
+     * the bus has to be taken, the same for all wr_ functions
+     *
+     * @param dat data written to LCD controller
+     *
+     */
+    void wr_dat(unsigned char value);
+
+    /** Write a command the LCD controller
+      *
+      * @param cmd: command to be written
+      *
+      */
+    void wr_cmd(unsigned char value);
+
+    void wr_cnt(unsigned char cmd);
+
+    /** Write a block of data to the LCD controller
+      *
+      * CS is asserted once for the whole block
+      *
+      * @param dat data written to LCD controller
+      * @param n number of bytes
+      */
+    void wr_dat_block(const uint8_t* dat, size_t n);
+
+    /** Write a sequence of commands to the LCD controller
+      *
+      * CS is asserted once for the whole sequence
+      *
+      * @param cmd commands to be written
+      * @param n number of commands
+      */
+    void wr_cmd_block(const uint8_t* cmd, size_t n);
+
+    /** send bytes back to back, CS and A0 have to be set up
+      *
+      */
+    void spi_burst(const uint8_t* p, size_t n);
+
+    /** update the lcd if auto update is on and no frame is open
+      *
+      */
+    void update(void);
+
+    /** width and height of the char cell of the active font
+      *
+      */
+    int font_width();
+    int font_height();
+
+    /** write the columns of a char into the buffer
+      *
+      * @param x,y top left
+      * @param data first column of the char
+      * @param bpl bytes per column
+      * @param hor number of columns
+      * @param vert height in pixel
+      * @param shifted 1 if the columns are already moved down by y % 8 rows
+      */
+    void glyph(int x, int y, const unsigned char* data, unsigned int bpl, unsigned int hor, unsigned int vert, int shifted);
+
+    /** glyph() in portrait : the rows of the char are turned into panel columns
+      *
+      */
+    void glyph_portrait(int x, int y, const unsigned char* data, unsigned int bpl, unsigned int hor, unsigned int vert);
+
+#if C12832_PACKED_FONTS
+    /** glyph of a packed font, decoded or from the cache
+      *
+      * @param c char, in the range of the font
+      * @returns columns of the char cell, bytes per column of the font
+      */
+    const unsigned char* packed_glyph(int c);
+#endif
+
+#if C12832_BITMAPS
+    /** blit to the screen, clipped, by whole bytes or by panel columns in portrait
+      *
+      */
+    template <class B> void blit_screen(const B& src, int sw, int sh, int sx, int sy, int w, int h, int x, int y, int rop);
+
+    /** blit a bit stream, the rows follow each other without padding
+      *
+      * @param bits w * h bits, bit 7 of a byte first
+      * @param rop raster operation
+      */
+    void blit_stream(int x, int y, int w, int h, const unsigned char* bits, int rop);
+#endif
+
+    /** map a screen position to the panel position
+      *
+      */
+    void to_panel(int& x, int& y);
+
+    /** mark a screen rectangle as changed
+      *
+      * @param x0,y0 top left corner, on the screen
+      * @param x1,y1 down right corner, on the screen
+      */
+    void mark_area(int x0, int y0, int x1, int y1);
+
+    /** mark a rectangle that may be partly outside the clip rectangle as changed
+      *
+      */
+    void mark_clipped(int x0, int y0, int x1, int y1);
+
+    /** clear panel rows of the buffer and mark them as changed
+      *
+      */
+    void clear_rows(int y0, int y1);
+
+    /** dirty column span and data of a RAM page of the controller
+      *
+      * @param k RAM page counted from the page of the start line
+      * @param s start line % 8
+      */
+    int ram_span(int k, int s, int& x0, int& x1);
+    const unsigned char* ram_data(int k, int s, int x0, int n);
+
+    /** take the dirty spans of the RAM pages for a pass, the pages are clean then
+      *
+      * with the interrupts off, a pass may start in an interrupt
+      *
+      * @param s start line % 8
+      * @param pages RAM pages of the pass, 4 or 5
+      * @param x0,x1 column span of each RAM page, x0 = 128 if clean
+      */
+    void take_spans(int s, int pages, unsigned char* x0, unsigned char* x1);
+
+    /** columns x0 .. x1 of a page with the shown layers put together
+      *
+      * @param slot buffer 0 or 1 for the result, used if more than the content is shown
+      * @returns data of column x0
+      */
+    const unsigned char* page_data(int page, int x0, int x1, int slot);
+
+#if C12832_LAYERS
+    /** take the memory of a layer if not done yet
+      *
+      */
+    void alloc_layer(int layer);
+
+    /** mark the columns a layer has been drawn on as changed
+      *
+      */
+    void mark_layer(int layer);
+#endif
+
+#if C12832_TERMINAL
+    /** terminal mode output
+      *
+      */
+    void term_putc(int value);
+    void term_newline(void);
+#endif
+
+    /** mark all columns of all pages as changed
+      *
+      */
+    void mark_all(void);
+
+    /** next run of bytes to send from the span of a RAM page
+      *
+      * without C12832_SHADOW or if the RAM page is not known the rest of
+      * the span is one run. Else the run takes the bytes that differ from
+      * the RAM, gaps shorter than a new column address are sent with it.
+      * The shadow takes the bytes of the run.
+      *
+      * @param page RAM page 0..7
+      * @param d data of the span, column x0 first
+      * @param n bytes in the span
+      * @param i first byte to look at
+      * @param len bytes in the run
+      * @returns first byte of the run, n if nothing is left to send
+      */
+    int next_run(int page, const unsigned char* d, int x0, int n, int i, int& len);
+
+    /** mark a column range of one page as changed
+      *
+      * @param page page 0..3
+      * @param x0 first changed column
+      * @param x1 last changed column
+      */
+    void mark_dirty(int page, int x0, int x1);
+
+    SPIBus* _own_bus;             // bus made by the constructor with pins, else NULL
+    SPIDevice* _dev;              // the panel on the bus
+    unsigned int orientation;
+    unsigned int char_x;
+    unsigned int char_y;
+    unsigned char* buffer;        // framebuffer of the layer drawn on
+    unsigned int contrast;
+#if C12832_AUTO_UP
+    unsigned int auto_up;
+#endif
+    unsigned char dirty_min[4];   // first changed column per page, 128 = clean
+    unsigned char dirty_max[4];   // last changed column per page
+    unsigned int bytes_sent;
+    unsigned int bytes_saved;
+    unsigned int frame_depth;     // open begin_frame() calls
+    int clip_x0;                  // clip rectangle on the screen
+    int clip_y0;
+    int clip_x1;
+    int clip_y1;
+    unsigned int flush_count;
+    int scroll_line;              // RAM line at the top of the screen
+    int start_line;               // start line set in the controller
+    int col_offset;               // RAM column of screen column 0, 4 if turned
+    int line_offset;              // start line register - start_line, 32 if turned
+    uint32_t line_buf[32];        // RAM page made of two buffer pages
+#if C12832_SHADOW
+    uint32_t shadow[8][32];       // RAM of the controller, what the lcd shows
+    unsigned int shadow_ok;       // bit per RAM page, 0 = RAM not known
+#endif
+
+    uint32_t frame[128];          // content layer
+
+#if C12832_LAYERS
+    // layers
+    unsigned char* layer_buf[3];  // framebuffer of each layer, NULL = not used yet
+    unsigned char layer_rule[3];
+    unsigned int layer_shown;     // bit per layer
+    int draw_layer;               // layer drawn on
+    unsigned char layer_min[3][4];  // columns drawn on since the layer was cleared
+    unsigned char layer_max[3][4];
+    uint32_t comp_buf[2][32];     // pages put together from the layers
+#endif
+
+#if C12832_PACKED_FONTS
+    // glyphs of packed fonts, least recently used is replaced
+    struct GlyphEntry {
+        const unsigned char* font;
+        int c;
+        unsigned int used;        // glyph_tick of the last use, 0 = empty
+        unsigned char data[GLYPH_BYTES];
+    };
+    GlyphEntry glyph_cache[GLYPH_CACHE];
+    unsigned int glyph_tick;
+    unsigned int glyph_decodes;
+#endif
+
+#if C12832_TERMINAL
+    // terminal mode
+    char* term_buf;               // ring of text lines
+    unsigned int term_lines;      // lines in the ring, 0 = off
+    unsigned int term_head;       // line written now
+    unsigned int term_count;      // lines in use
+    int term_len;                 // chars in the line written now
+    unsigned int term_back;       // lines shown back
+#endif
+
+    // asynchronous update
+    void send_pass(void);
+    void flush_pass(void);
+    void start_dma_pass(void);
+    void start_dma_page(void);
+    void dma_isr(void);
+    friend void lcd_dma_irq(int n);
+
+    volatile int dma_page;        // page sent by DMA, 0 while an update without DMA waits, -1 = idle
+    volatile int dma_again;       // flush_async() called while busy
+    unsigned char dma_x0[5];      // column span of the RAM pages of the running pass
+    unsigned char dma_x1[5];
+    int dma_pages;                // RAM pages in the pass, 5 if the start line is not page aligned
+    int dma_line;                 // start line of the running pass
+    const unsigned char* dma_data;   // span of the RAM page sent now
+    int dma_run;                  // first byte of the run sent now
+    int dma_len;                  // bytes of this run
+    int dma_index;                // entry in the SPI/DMA table, -1 = not known
+    Callback<void()> flush_done;
+
+};
+
+
+
+
+#endif
@@ -0,0 +1,101 @@
+/* compile time configuration of the C12832 / GraphicsDisplay / TextDisplay stack
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * Every part is on by default, the library then works as before.
+ * C12832_SHADOW is off by default, it takes 1 KB of RAM and changes
+ * what cls() sends.
+ * A project switches parts off with defines on the command line or
+ * in its mbed_app.json :
+ *
+ *   "macros": ["C12832_FONT8X8=0", "C12832_STDIO=0", "C12832_SHAPES=0"]
+ *
+ * A part that is off is not compiled, a program that uses it does not
+ * compile either. tools/sizes/sizes.sh shows flash and RAM of the
+ * stack for each example with some feature sets.
+ *
+ * Functions that are not called are removed by the linker anyway,
+ * the switches matter for the parts that are always linked :
+ * virtual functions of GraphicsDisplay and TextDisplay, the stdio
+ * redirection, the members of C12832 and the code on the paths of
+ * putc, the update and scroll.
+ */
+
+#ifndef C12832_CONFIG_H
+#define C12832_CONFIG_H
+
+/** C12832_BITMAPS : print_bm, blit, get_area of C12832 and window, putp,
+  * fill, blit, blitbit of GraphicsDisplay. SpriteManager needs it.
+  */
+#ifndef C12832_BITMAPS
+#define C12832_BITMAPS  1
+#endif
+
+/** C12832_FONT8X8 : the 8x8 font of GraphicsDisplay, character() of the
+  * base class. C12832 draws its chars with its own fonts.
+  * Off with C12832_BITMAPS if not given.
+  */
+#ifndef C12832_FONT8X8
+#define C12832_FONT8X8  C12832_BITMAPS
+#endif
+
+/** C12832_SHAPES : circle, fillcircle, fillroundrect, filltriangle,
+  * fillpolygon. pixel, line, rect and fillrect are always there.
+  */
+#ifndef C12832_SHAPES
+#define C12832_SHAPES  1
+#endif
+
+/** C12832_PACKED_FONTS : packed fonts with the glyph cache, packed bitmaps
+  */
+#ifndef C12832_PACKED_FONTS
+#define C12832_PACKED_FONTS  1
+#endif
+
+/** C12832_LAYERS : background and overlay layer, only the content layer
+  * is there if off
+  */
+#ifndef C12832_LAYERS
+#define C12832_LAYERS  1
+#endif
+
+/** C12832_TERMINAL : terminal mode with scroll back, scroll() stays
+  */
+#ifndef C12832_TERMINAL
+#define C12832_TERMINAL  1
+#endif
+
+/** C12832_STDIO : claim() to redirect stdout / stderr to the display and
+  * the name of the stream in the file system
+  */
+#ifndef C12832_STDIO
+#define C12832_STDIO  1
+#endif
+
+/** C12832_AUTO_UP : update the lcd after each drawing function.
+  * If off the program calls copy_to_lcd() or flush_async(),
+  * set_auto_up() is not there.
+  */
+#ifndef C12832_AUTO_UP
+#define C12832_AUTO_UP  1
+#endif
+
+/** C12832_SHADOW : a copy of the RAM of the controller, 1 KB. An update
+  * only sends the bytes that differ from it. cls() and invalidate()
+  * send the whole screen once more. Off by default.
+  */
+#ifndef C12832_SHADOW
+#define C12832_SHADOW  0
+#endif
+
+/** GLYPH_CACHE : decoded glyphs of packed fonts kept in RAM,
+  * GLYPH_BYTES + 12 bytes each
+  */
+#ifndef GLYPH_CACHE
+#define GLYPH_CACHE  16
+#endif
+
+#if C12832_FONT8X8 && !C12832_BITMAPS
+#error "C12832_FONT8X8 needs C12832_BITMAPS, the 8x8 font is drawn by blitbit()"
+#endif
+
+#endif
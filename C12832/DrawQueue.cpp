@@ -0,0 +1,329 @@
+/* queue of draw commands for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ */
+
+// 16.10.26    initial design
+
+#include "DrawQueue.h"
+#include "stdarg.h"
+
+#define DRAWQ_SPEC  16   // chars of a conversion like %-8.3lf, with the 0
+
+enum {ARG_NONE, ARG_INT, ARG_LONG, ARG_DOUBLE, ARG_STRING, ARG_POINTER};
+
+// the argument a conversion reads
+
+static int arg_type(char conv, int longs)
+{
+    if(longs > 1) return ARG_NONE;    // ll
+    switch(conv) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            return longs ? ARG_LONG : ARG_INT;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+            return ARG_DOUBLE;        // %lf is a double too
+        case 'c':
+            return longs ? ARG_NONE : ARG_INT;
+        case 's':
+            return longs ? ARG_NONE : ARG_STRING;
+        case 'p':
+            return longs ? ARG_NONE : ARG_POINTER;
+    }
+    return ARG_NONE;                  // *, %n or unknown
+}
+
+// length of the conversion at f[0] = '%' : flags, width, precision,
+// h or l and the conversion char
+
+static int spec_len(const char* f, int& type)
+{
+    int i = 1, longs = 0;
+
+    while(f[i] == '-' || f[i] == '+' || f[i] == ' ' || f[i] == '#' || f[i] == '0') i++;
+    while(f[i] >= '0' && f[i] <= '9') i++;
+    if(f[i] == '.') {
+        i++;
+        while(f[i] >= '0' && f[i] <= '9') i++;
+    }
+    while(f[i] == 'h' || f[i] == 'l') {
+        if(f[i] == 'l') longs++;
+        i++;
+    }
+    type = arg_type(f[i], longs);
+    if(i + 1 >= DRAWQ_SPEC) type = ARG_NONE;
+    return i + 1;
+}
+
+DrawQueue::DrawQueue(C12832& lcd)
+    : _lcd(lcd), _head(0), _tail(0), _dropped(0)
+{
+    int i;
+
+    for(i = 0; i < DRAWQ_SIZE; i++) _cmd[i].ready = 0;
+}
+
+// take the next slot, the only part with the interrupts off.
+// The slot stays not ready until post(), drain() waits for it.
+
+DrawQueue::Command* DrawQueue::take(int type, int layer)
+{
+    Command* c = NULL;
+
+    __disable_irq();
+    if(_head - _tail < DRAWQ_SIZE) {
+        c = &_cmd[_head % DRAWQ_SIZE];
+        _head++;
+    } else {
+        _dropped++;
+    }
+    __enable_irq();
+    if(c == NULL) return NULL;
+    c->type = type;
+    c->layer = layer;
+    return c;
+}
+
+void DrawQueue::post(Command* c)
+{
+    __disable_irq();                  // the command is in memory before it is ready
+    c->ready = 1;
+    __enable_irq();
+}
+
+bool DrawQueue::text(int x, int y, const char* s, int layer)
+{
+    Command* c = take(CMD_TEXT, layer);
+
+    if(c == NULL) return false;
+    c->x0 = x;
+    c->y0 = y;
+    strncpy(c->text, s, DRAWQ_TEXT - 1);
+    c->text[DRAWQ_TEXT - 1] = 0;
+    post(c);
+    return true;
+}
+
+// only the arguments are taken here, in the interrupt :
+// the format is scanned for their types, format() does the rest
+
+bool DrawQueue::printf(int x, int y, const char* format, ...)
+{
+    Command* c = take(CMD_FORMAT, LAYER_CONTENT);
+    va_list arg;
+    int i, n, type;
+
+    if(c == NULL) return false;
+    c->x0 = x;
+    c->y0 = y;
+    c->fmt.format = format;
+    n = 0;
+    va_start(arg, format);
+    for(i = 0; format[i] != 0 && n < DRAWQ_ARGS; i++) {
+        if(format[i] != '%') continue;
+        if(format[i + 1] == '%') {
+            i++;
+            continue;
+        }
+        i += spec_len(&format[i], type) - 1;
+        if(type == ARG_NONE) break;   // the text ends here
+        c->fmt.type[n] = type;
+        switch(type) {
+            case ARG_INT:
+                c->fmt.arg[n].i = va_arg(arg, int);
+                break;
+            case ARG_LONG:
+                c->fmt.arg[n].l = va_arg(arg, long);
+                break;
+            case ARG_DOUBLE:
+                c->fmt.arg[n].d = va_arg(arg, double);
+                break;
+            case ARG_STRING:
+                c->fmt.arg[n].s = va_arg(arg, const char*);
+                break;
+            default:
+                c->fmt.arg[n].p = va_arg(arg, void*);
+        }
+        n++;
+    }
+    va_end(arg);
+    post(c);
+    return true;
+}
+
+bool DrawQueue::fill(int x0, int y0, int x1, int y1, int colour, int layer)
+{
+    Command* c = take(CMD_FILL, layer);
+
+    if(c == NULL) return false;
+    c->x0 = x0;
+    c->y0 = y0;
+    c->x1 = x1;
+    c->y1 = y1;
+    c->arg = colour;
+    post(c);
+    return true;
+}
+
+#if C12832_BITMAPS
+bool DrawQueue::blit(const Bitmap& bm, int x, int y, int rop, int layer)
+{
+    Command* c = take(CMD_BLIT, layer);
+
+    if(c == NULL) return false;
+    c->x0 = x;
+    c->y0 = y;
+    c->arg = rop;
+    c->bitmap = &bm;
+    post(c);
+    return true;
+}
+#endif
+
+#if C12832_LAYERS
+bool DrawQueue::show(int layer, unsigned int on)
+{
+    Command* c = take(CMD_SHOW, layer);
+
+    if(c == NULL) return false;
+    c->arg = on;
+    post(c);
+    return true;
+}
+#endif
+
+bool DrawQueue::invalidate(void)
+{
+    Command* c = take(CMD_INVALIDATE, LAYER_CONTENT);
+
+    if(c == NULL) return false;
+    post(c);
+    return true;
+}
+
+// text of a printf command, one conversion at a time,
+// it ends where printf() stopped taking arguments
+
+void DrawQueue::format(const Command* c, char* line)
+{
+    const char* f = c->fmt.format;
+    char spec[DRAWQ_SPEC];
+    int i, n, pos, len, type, k;
+
+    n = 0;
+    pos = 0;
+    for(i = 0; f[i] != 0 && pos < DRAWQ_TEXT - 1; i++) {
+        if(f[i] != '%') {
+            line[pos++] = f[i];
+            continue;
+        }
+        if(f[i + 1] == '%') {
+            line[pos++] = '%';
+            i++;
+            continue;
+        }
+        len = spec_len(&f[i], type);
+        if(type == ARG_NONE || n == DRAWQ_ARGS) break;
+        memcpy(spec, &f[i], len);
+        spec[len] = 0;
+        switch(type) {
+            case ARG_INT:
+                k = snprintf(line + pos, DRAWQ_TEXT - pos, spec, c->fmt.arg[n].i);
+                break;
+            case ARG_LONG:
+                k = snprintf(line + pos, DRAWQ_TEXT - pos, spec, c->fmt.arg[n].l);
+                break;
+            case ARG_DOUBLE:
+                k = snprintf(line + pos, DRAWQ_TEXT - pos, spec, c->fmt.arg[n].d);
+                break;
+            case ARG_STRING:
+                k = snprintf(line + pos, DRAWQ_TEXT - pos, spec, c->fmt.arg[n].s);
+                break;
+            default:
+                k = snprintf(line + pos, DRAWQ_TEXT - pos, spec, c->fmt.arg[n].p);
+        }
+        if(k > 0) pos += k;           // the length without the cut
+        if(pos > DRAWQ_TEXT - 1) pos = DRAWQ_TEXT - 1;
+        n++;
+        i += len - 1;
+    }
+    line[pos] = 0;
+}
+
+// draw one command on its layer
+
+void DrawQueue::run(Command* c)
+{
+    char line[DRAWQ_TEXT];
+
+#if C12832_LAYERS
+    if(c->type != CMD_SHOW && c->type != CMD_INVALIDATE) _lcd.select_layer(c->layer);
+#endif
+    switch(c->type) {
+        case CMD_TEXT:
+            _lcd.locate(c->x0, c->y0);
+            _lcd.printf("%s", c->text);
+            break;
+        case CMD_FORMAT:
+            format(c, line);
+            _lcd.locate(c->x0, c->y0);
+            _lcd.printf("%s", line);
+            break;
+        case CMD_FILL:
+            _lcd.fillrect(c->x0, c->y0, c->x1, c->y1, c->arg);
+            break;
+#if C12832_BITMAPS
+        case CMD_BLIT:
+            _lcd.blit(*c->bitmap, 0, 0, c->bitmap->xSize, c->bitmap->ySize, c->x0, c->y0, c->arg);
+            break;
+#endif
+#if C12832_LAYERS
+        case CMD_SHOW:
+            _lcd.show_layer(c->layer, c->arg);
+            break;
+#endif
+        case CMD_INVALIDATE:
+            _lcd.invalidate();
+            break;
+    }
+}
+
+// the slot is given back after the command is drawn,
+// an interrupt meanwhile takes another one
+
+int DrawQueue::drain(void)
+{
+    Command* c;
+    int n = 0;
+#if C12832_LAYERS
+    int layer = _lcd.get_layer();
+#endif
+
+    _lcd.begin_frame();
+    while(_tail != _head) {
+        c = &_cmd[_tail % DRAWQ_SIZE];
+        if(!c->ready) break;          // still written by an interrupt
+        run(c);
+        c->ready = 0;
+        _tail++;
+        n++;
+    }
+#if C12832_LAYERS
+    _lcd.select_layer(layer);
+#endif
+    _lcd.end_frame();
+    return n;
+}
+
+unsigned int DrawQueue::get_dropped(void)
+{
+    return _dropped;
+}
@@ -0,0 +1,171 @@
+/* queue of draw commands for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * Drawing from an interrupt blocks the interrupt for the SPI transfer
+ * of the update, and a second interrupt can draw into the middle of it.
+ * With DrawQueue the interrupts only put small commands into a ring :
+ * text, fill, blit, show a layer and invalidate. The main loop calls
+ * drain(), it draws all waiting commands as one frame. Only the main
+ * loop uses the lcd then.
+ *
+ * Any interrupt and the main loop may post. A slot is taken with the
+ * interrupts off for a few instructions, the command is written into it
+ * afterwards and marked ready. drain() stops at the first slot that is
+ * not ready yet, so the commands are drawn in the order the slots were
+ * taken. If the ring is full the command is dropped and counted.
+ *
+ * A command is 12 bytes and the text or the arguments of a printf,
+ * 56 bytes on the target. text() copies the text and takes a few us.
+ * printf() only stores the format and its arguments; drain() formats
+ * them, so no float is formatted in the interrupt.
+ *
+ * @code
+ * C12832 lcd(D11, D13, D12, D7, D10);
+ * DrawQueue queue(lcd);
+ *
+ * void pressed() { queue.printf(0, 0, "count %d", ++count); }
+ *
+ * button.rise(&pressed);
+ * while(1) {
+ *     queue.drain();
+ *     wait(0.02);
+ * }
+ * @endcode
+ */
+
+#ifndef DRAWQUEUE_H
+#define DRAWQUEUE_H
+
+#include "C12832.h"
+
+#define DRAWQ_SIZE  16   // commands in the ring
+#define DRAWQ_TEXT  24   // chars of a text command, with the 0
+#define DRAWQ_ARGS  4    // arguments of a printf command
+
+class DrawQueue
+{
+public:
+    /** Create a command queue for a C12832
+      *
+      * @param lcd display
+      */
+    DrawQueue(C12832& lcd);
+
+    /** draw a text
+      *
+      * @param x,y top left corner of the first char
+      * @param s text, cut to DRAWQ_TEXT - 1 chars
+      * @param layer layer drawn on
+      * @returns false if the queue is full
+      */
+    bool text(int x, int y, const char* s, int layer = LAYER_CONTENT);
+
+    /** draw a text on the content layer, printf format
+      *
+      * the format and up to DRAWQ_ARGS arguments are stored, drain()
+      * formats them and cuts the text to DRAWQ_TEXT - 1 chars. The
+      * format and %s strings are not copied and have to stay, like a
+      * string constant. %d %i %u %o %x %X %c with h or l, %e %f %g
+      * with l, %s and %p are known. The text ends before a *, ll, %n,
+      * an unknown conversion or a conversion after DRAWQ_ARGS.
+      *
+      * @param x,y top left corner of the first char
+      * @param format printf format string
+      * @returns false if the queue is full
+      */
+    bool printf(int x, int y, const char* format, ...);
+
+    /** fill a rectangle
+      *
+      * @param x0,y0 top left corner
+      * @param x1,y1 down right corner
+      * @param colour 1 set pixel, 0 erase pixel
+      * @param layer layer drawn on
+      * @returns false if the queue is full
+      */
+    bool fill(int x0, int y0, int x1, int y1, int colour, int layer = LAYER_CONTENT);
+
+#if C12832_BITMAPS
+    /** copy a bitmap, the bitmap is not copied and has to stay
+      *
+      * @param bm bitmap, in flash or static
+      * @param x,y top left corner
+      * @param rop BLT_COPY, BLT_OR, BLT_AND, BLT_XOR or BLT_NOT
+      * @param layer layer drawn on
+      * @returns false if the queue is full
+      */
+    bool blit(const Bitmap& bm, int x, int y, int rop = BLT_COPY, int layer = LAYER_CONTENT);
+#endif
+
+#if C12832_LAYERS
+    /** show or hide a layer
+      *
+      * @param layer LAYER_BACKGROUND, LAYER_CONTENT or LAYER_OVERLAY
+      * @param on 1 = show, 0 = hide
+      * @returns false if the queue is full
+      */
+    bool show(int layer, unsigned int on);
+#endif
+
+    /** send the whole screen again at the next update
+      *
+      * @returns false if the queue is full
+      */
+    bool invalidate(void);
+
+    /** draw the waiting commands, in the main loop only
+      *
+      * all commands are drawn as one frame
+      *
+      * @returns number of commands drawn
+      */
+    int drain(void);
+
+    /** get the number of commands dropped because the queue was full
+      *
+      */
+    unsigned int get_dropped(void);
+
+private:
+    enum {CMD_TEXT, CMD_FORMAT, CMD_FILL, CMD_BLIT, CMD_SHOW, CMD_INVALIDATE};
+
+    union Value {
+        int i;
+        long l;
+        double d;
+        const char* s;
+        void* p;
+    };
+
+    struct Format {
+        const char* format;
+        unsigned char type[DRAWQ_ARGS];
+        Value arg[DRAWQ_ARGS];
+    };
+
+    struct Command {
+        volatile unsigned char ready; // written completely
+        unsigned char type;
+        unsigned char layer;
+        unsigned char arg;            // colour, rop or on
+        short x0, y0, x1, y1;
+        union {
+            char text[DRAWQ_TEXT];
+            Format fmt;
+            const Bitmap* bitmap;
+        };
+    };
+
+    Command* take(int type, int layer);
+    void post(Command* c);
+    void run(Command* c);
+    void format(const Command* c, char* line);
+
+    C12832& _lcd;
+    Command _cmd[DRAWQ_SIZE];
+    volatile unsigned int _head;  // slots taken
+    volatile unsigned int _tail;  // slots drawn, only changed by drain()
+    volatile unsigned int _dropped;
+};
+
+#endif
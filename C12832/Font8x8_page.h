@@ -0,0 +1,114 @@
+// generated by tools/fontconv from GraphicsDisplay.cpp, do not edit
+// page font, see PageFont.h
+
+#ifndef font8x8_page
+#define font8x8_page
+
+const unsigned char Font8x8_page[] = {
+        0x00, 'P', 32, 127, 8, 8, 1, 1,        // magic, first, last, height, width, bytes/column, variants
+        // advance
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Code for char  
+        0x00, 0x06, 0x5F, 0x5F, 0x06, 0x00, 0x00, 0x00,  // Code for char !
+        0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00, 0x00,  // Code for char "
+        0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14, 0x00,  // Code for char #
+        0x00, 0x24, 0x2E, 0x6B, 0x6B, 0x3A, 0x12, 0x00,  // Code for char $
+        0x00, 0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62,  // Code for char %
+        0x00, 0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48,  // Code for char &
+        0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,  // Code for char '
+        0x00, 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x00, 0x00,  // Code for char (
+        0x00, 0x00, 0x41, 0x63, 0x3E, 0x1C, 0x00, 0x00,  // Code for char )
+        0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08,  // Code for char *
+        0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08, 0x00, 0x00,  // Code for char +
+        0x00, 0x00, 0x80, 0xE0, 0x60, 0x00, 0x00, 0x00,  // Code for char ,
+        0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,  // Code for char -
+        0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,  // Code for char .
+        0x00, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,  // Code for char /
+        0x00, 0x3E, 0x7F, 0x41, 0x49, 0x41, 0x7F, 0x3E,  // Code for char 0
+        0x00, 0x44, 0x42, 0x7F, 0x7F, 0x40, 0x40, 0x00,  // Code for char 1
+        0x00, 0x62, 0x73, 0x59, 0x49, 0x6F, 0x66, 0x00,  // Code for char 2
+        0x00, 0x22, 0x63, 0x49, 0x49, 0x7F, 0x36, 0x00,  // Code for char 3
+        0x00, 0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50,  // Code for char 4
+        0x00, 0x27, 0x67, 0x45, 0x45, 0x7D, 0x39, 0x00,  // Code for char 5
+        0x00, 0x3C, 0x7E, 0x4B, 0x49, 0x79, 0x30, 0x00,  // Code for char 6
+        0x00, 0x03, 0x03, 0x71, 0x79, 0x0F, 0x07, 0x00,  // Code for char 7
+        0x00, 0x36, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00,  // Code for char 8
+        0x00, 0x06, 0x4F, 0x49, 0x69, 0x3F, 0x1E, 0x00,  // Code for char 9
+        0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,  // Code for char :
+        0x00, 0x00, 0x80, 0xE6, 0x66, 0x00, 0x00, 0x00,  // Code for char ;
+        0x00, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x00, 0x00,  // Code for char <
+        0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00,  // Code for char =
+        0x00, 0x00, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x00,  // Code for char >
+        0x00, 0x02, 0x03, 0x51, 0x59, 0x0F, 0x06, 0x00,  // Code for char ?
+        0x00, 0x3E, 0x7F, 0x41, 0x5D, 0x55, 0x57, 0x1E,  // Code for char @
+        0x00, 0x7C, 0x7E, 0x13, 0x13, 0x7E, 0x7C, 0x00,  // Code for char A
+        0x00, 0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36,  // Code for char B
+        0x00, 0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22,  // Code for char C
+        0x00, 0x41, 0x7F, 0x7F, 0x41, 0x63, 0x3E, 0x1C,  // Code for char D
+        0x00, 0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63,  // Code for char E
+        0x00, 0x41, 0x7F, 0x7F, 0x49, 0x1D, 0x01, 0x03,  // Code for char F
+        0x00, 0x1C, 0x3E, 0x63, 0x41, 0x51, 0x73, 0x72,  // Code for char G
+        0x00, 0x7F, 0x7F, 0x08, 0x08, 0x7F, 0x7F, 0x00,  // Code for char H
+        0x00, 0x00, 0x41, 0x7F, 0x7F, 0x41, 0x00, 0x00,  // Code for char I
+        0x00, 0x30, 0x70, 0x40, 0x41, 0x7F, 0x3F, 0x01,  // Code for char J
+        0x00, 0x41, 0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63,  // Code for char K
+        0x00, 0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70,  // Code for char L
+        0x00, 0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F,  // Code for char M
+        0x00, 0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F,  // Code for char N
+        0x00, 0x3E, 0x7F, 0x41, 0x41, 0x41, 0x7F, 0x3E,  // Code for char O
+        0x00, 0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06,  // Code for char P
+        0x00, 0x1E, 0x3F, 0x21, 0x71, 0x7F, 0x5E, 0x00,  // Code for char Q
+        0x00, 0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66,  // Code for char R
+        0x00, 0x22, 0x67, 0x4D, 0x59, 0x73, 0x22, 0x00,  // Code for char S
+        0x00, 0x03, 0x41, 0x7F, 0x7F, 0x41, 0x03, 0x00,  // Code for char T
+        0x00, 0x7F, 0x7F, 0x40, 0x40, 0x7F, 0x7F, 0x00,  // Code for char U
+        0x00, 0x1F, 0x3F, 0x60, 0x60, 0x3F, 0x1F, 0x00,  // Code for char V
+        0x00, 0x7F, 0x7F, 0x30, 0x18, 0x30, 0x7F, 0x7F,  // Code for char W
+        0x00, 0x43, 0x67, 0x3C, 0x18, 0x3C, 0x67, 0x43,  // Code for char X
+        0x00, 0x07, 0x4F, 0x78, 0x78, 0x4F, 0x07, 0x00,  // Code for char Y
+        0x00, 0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73,  // Code for char Z
+        0x00, 0x00, 0x7F, 0x7F, 0x41, 0x41, 0x00, 0x00,  // Code for char [
+        0x00, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60,  // Code for char \ (back slash)
+        0x00, 0x00, 0x41, 0x41, 0x7F, 0x7F, 0x00, 0x00,  // Code for char ]
+        0x00, 0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08,  // Code for char ^
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,  // Code for char _
+        0x00, 0x00, 0x00, 0x03, 0x07, 0x04, 0x00, 0x00,  // Code for char `
+        0x00, 0x20, 0x74, 0x54, 0x54, 0x3C, 0x78, 0x40,  // Code for char a
+        0x00, 0x41, 0x7F, 0x3F, 0x44, 0x44, 0x7C, 0x38,  // Code for char b
+        0x00, 0x38, 0x7C, 0x44, 0x44, 0x6C, 0x28, 0x00,  // Code for char c
+        0x00, 0x38, 0x7C, 0x44, 0x45, 0x3F, 0x7F, 0x40,  // Code for char d
+        0x00, 0x38, 0x7C, 0x54, 0x54, 0x5C, 0x18, 0x00,  // Code for char e
+        0x00, 0x48, 0x7E, 0x7F, 0x49, 0x03, 0x02, 0x00,  // Code for char f
+        0x00, 0x98, 0xBC, 0xA4, 0xA4, 0xF8, 0x7C, 0x04,  // Code for char g
+        0x00, 0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78,  // Code for char h
+        0x00, 0x00, 0x44, 0x7D, 0x7D, 0x40, 0x00, 0x00,  // Code for char i
+        0x00, 0x60, 0xE0, 0x80, 0x80, 0xFD, 0x7D, 0x00,  // Code for char j
+        0x00, 0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C, 0x44,  // Code for char k
+        0x00, 0x00, 0x41, 0x7F, 0x7F, 0x40, 0x00, 0x00,  // Code for char l
+        0x00, 0x7C, 0x7C, 0x18, 0x38, 0x1C, 0x7C, 0x78,  // Code for char m
+        0x00, 0x7C, 0x7C, 0x04, 0x04, 0x7C, 0x78, 0x00,  // Code for char n
+        0x00, 0x38, 0x7C, 0x44, 0x44, 0x7C, 0x38, 0x00,  // Code for char o
+        0x00, 0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18,  // Code for char p
+        0x00, 0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84,  // Code for char q
+        0x00, 0x44, 0x7C, 0x78, 0x4C, 0x04, 0x1C, 0x18,  // Code for char r
+        0x00, 0x48, 0x5C, 0x54, 0x54, 0x74, 0x24, 0x00,  // Code for char s
+        0x00, 0x00, 0x04, 0x3E, 0x7F, 0x44, 0x24, 0x00,  // Code for char t
+        0x00, 0x3C, 0x7C, 0x40, 0x40, 0x3C, 0x7C, 0x40,  // Code for char u
+        0x00, 0x1C, 0x3C, 0x60, 0x60, 0x3C, 0x1C, 0x00,  // Code for char v
+        0x00, 0x3C, 0x7C, 0x70, 0x38, 0x70, 0x7C, 0x3C,  // Code for char w
+        0x00, 0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44,  // Code for char x
+        0x00, 0x9C, 0xBC, 0xA0, 0xA0, 0xFC, 0x7C, 0x00,  // Code for char y
+        0x00, 0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64, 0x00,  // Code for char z
+        0x00, 0x08, 0x08, 0x3E, 0x77, 0x41, 0x41, 0x00,  // Code for char {
+        0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00,  // Code for char |
+        0x00, 0x41, 0x41, 0x77, 0x3E, 0x08, 0x08, 0x00,  // Code for char }
+        0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x01,  // Code for char ~
+        0x00, 0x00, 0x06, 0x0F, 0x09, 0x0F, 0x06, 0x00   // Code for char  
+        };
+
+#endif
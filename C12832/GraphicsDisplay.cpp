@@ -5,6 +5,7 @@
  
 #include "GraphicsDisplay.h"
 
+#if C12832_FONT8X8
 const unsigned char FONT8x8[97][8] = {
 0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00, // columns, rows, num_bytes_per_char
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // space 0x20
@@ -103,16 +104,20 @@ const unsigned char FONT8x8[97][8] = {
 0x70,0x18,0x18,0x0E,0x18,0x18,0x70,0x00, // }
 0x3B,0x6E,0x00,0x00,0x00,0x00,0x00,0x00, // ~
 0x1C,0x36,0x36,0x1C,0x00,0x00,0x00,0x00}; // DEL
+#endif
     
 GraphicsDisplay::GraphicsDisplay(const char *name):TextDisplay(name) {
     foreground(0xFFFF);
     background(0x0000);
 }
     
+#if C12832_FONT8X8
 void GraphicsDisplay::character(int column, int row, int value) { 
     blitbit(column * 8, row * 8, 8, 8, (char*)&(FONT8x8[value - 0x1F][0]));
 }
+#endif
 
+#if C12832_BITMAPS
 void GraphicsDisplay::window(int x, int y, int w, int h) {
     // current pixel location
     _x = x;
@@ -165,6 +170,24 @@ void GraphicsDisplay::blitbit(int x, int y, int w, int h, const char* colour) {
         putp(c);
     }
 }
+
+void GraphicsDisplay::fill_span(int x0, int x1, int y, int colour) {
+    if(x1 < x0) {
+        int t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    fill(x0, y, x1 - x0 + 1, 1, colour);
+}
+
+void GraphicsDisplay::blit_native(int x, int y, int w, int h, const unsigned char* data) {
+    window(x, y, w, h);
+    for(int i = 0; i < w*h; i++) {
+        int row = i / w;
+        putp((data[(row >> 3) * w + i % w] >> (row & 7)) & 1);
+    }
+}
+#endif
     
 int GraphicsDisplay::columns() { 
     return width() / 8; 
@@ -8,7 +8,10 @@
  * at a location), width and height functions. Everything else
  * (locate, printf, putc, cls, window, putp, fill, blit, blitbit) 
  * will come for free. You can also provide a specialised implementation
- * of window and putp to speed up the results
+ * of window and putp to speed up the results, or of the bulk
+ * operations fill, fill_span, blit, blitbit and blit_native
+ *
+ * see C12832_config.h for the parts that can be switched off
  */
 
 #ifndef MBED_GRAPHICSDISPLAY_H
@@ -26,6 +29,7 @@ public:
     virtual int width() = 0;
     virtual int height() = 0;
         
+#if C12832_BITMAPS
     virtual void window(int x, int y, int w, int h);
     virtual void putp(int colour);
     
@@ -33,13 +37,30 @@ public:
     virtual void fill(int x, int y, int w, int h, int colour);
     virtual void blit(int x, int y, int w, int h, const int *colour);    
     virtual void blitbit(int x, int y, int w, int h, const char* colour);
+
+    /** bulk operations
+      * a display overrides them to work on its own memory, the
+      * defaults go pixel by pixel through window() and putp()
+      *
+      * fill_span   fill the row y from x0 to x1
+      * blit_native copy a rectangle in the memory layout of the display,
+      *             for 1 bit displays pages of 8 rows, bit 0 = top row,
+      *             w bytes per page (PageBitmap in Blit.h), a set bit
+      *             is colour 1
+      */
+    virtual void fill_span(int x0, int x1, int y, int colour);
+    virtual void blit_native(int x, int y, int w, int h, const unsigned char* data);
+#endif
     
+#if C12832_FONT8X8
     virtual void character(int column, int row, int value);
+#endif
     virtual int columns();
     virtual int rows();
     
 protected:
 
+#if C12832_BITMAPS
     // pixel location
     short _x;
     short _y;
@@ -49,6 +70,7 @@ protected:
     short _x2;
     short _y1;
     short _y2;
+#endif
 
 };
 
@@ -0,0 +1,308 @@
+/* 2 bit gray levels for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ */
+
+// 16.10.26    initial design
+
+#include "GrayScale.h"
+
+#if C12832_BITMAPS
+
+#define GRAY_PAGES  16   // pages of the screen in portrait
+
+GrayScale::GrayScale(C12832& lcd, int layer)
+    : _lcd(lcd), _layer(layer), _phase(0), _shown(-1), _sent(0), _frames(0), _bytes(0), _late(0)
+{
+    int k, page;
+#if C12832_LAYERS
+    int old;
+
+    old = lcd.get_layer();            // the memory of the layer is taken here,
+    lcd.select_layer(layer);          // not by new in the interrupt of frame()
+    lcd.select_layer(old);
+#endif
+
+    _width = lcd.width();
+    _height = lcd.height();
+    _pages = (_height + 7) >> 3;
+    for(k = 0; k < 2; k++) {
+        _plane[k] = new unsigned char[_width * _pages];
+        memset(_plane[k], 0x00, _width * _pages);
+    }
+    _chg_min = new unsigned char[_pages];
+    _chg_max = new unsigned char[_pages];
+    for(page = 0; page < _pages; page++) {
+        _chg_min[page] = 128;         // nothing drawn
+        _chg_max[page] = 0;
+    }
+}
+
+GrayScale::~GrayScale()
+{
+    _ticker.detach();
+    delete[] _plane[0];
+    delete[] _plane[1];
+    delete[] _chg_min;
+    delete[] _chg_max;
+}
+
+// remember the drawn columns, after the planes are written :
+// a frame in between sends them now or with the next frame.
+// The frame of the ticker takes a span and clears it, so both ends of
+// a span are set with the interrupts off, like mark_dirty() of C12832.
+
+void GrayScale::mark(int x0, int y0, int x1, int y1)
+{
+    int page;
+
+    for(page = y0 >> 3; page <= (y1 >> 3); page++) {
+        __disable_irq();
+        if(x0 < _chg_min[page]) _chg_min[page] = x0;
+        if(x1 > _chg_max[page]) _chg_max[page] = x1;
+        __enable_irq();
+    }
+}
+
+void GrayScale::changed(int x0, int y0, int x1, int y1)
+{
+    int t;
+
+    if(x0 > x1) {
+        t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if(y0 > y1) {
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 >= _width) x1 = _width - 1;
+    if(y1 >= _height) y1 = _height - 1;
+    if(x0 > x1 || y0 > y1) return;
+    mark(x0, y0, x1, y1);
+}
+
+void GrayScale::pixel(int x, int y, int level)
+{
+    unsigned char m;
+    int k;
+
+    if(x < 0 || y < 0 || x >= _width || y >= _height) return;
+    m = 1 << (y & 7);
+    for(k = 0; k < 2; k++) {
+        if(level & (1 << k)) _plane[k][(y >> 3) * _width + x] |= m;
+        else _plane[k][(y >> 3) * _width + x] &= ~m;
+    }
+    mark(x, y, x, y);
+}
+
+void GrayScale::fillrect(int x0, int y0, int x1, int y1, int level)
+{
+    unsigned char m;
+    unsigned char* p;
+    int k, page, x, t;
+
+    if(x0 > x1) {
+        t = x0;
+        x0 = x1;
+        x1 = t;
+    }
+    if(y0 > y1) {
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 >= _width) x1 = _width - 1;
+    if(y1 >= _height) y1 = _height - 1;
+    if(x0 > x1 || y0 > y1) return;
+
+    for(page = y0 >> 3; page <= (y1 >> 3); page++) {
+        m = 0xFF;
+        if(page == (y0 >> 3)) m &= 0xFF << (y0 & 7);
+        if(page == (y1 >> 3)) m &= 0xFF >> (7 - (y1 & 7));
+        for(k = 0; k < 2; k++) {
+            p = &_plane[k][page * _width];
+            if(level & (1 << k)) {
+                for(x = x0; x <= x1; x++) p[x] |= m;
+            } else {
+                for(x = x0; x <= x1; x++) p[x] &= ~m;
+            }
+        }
+    }
+    mark(x0, y0, x1, y1);
+}
+
+void GrayScale::image(const GrayBitmap& bm, int x, int y)
+{
+    PageBitmap dst, src;
+    int k, dx, dy, sx, sy, w, h;
+
+    for(k = 0; k < 2; k++) {
+        dst = get_plane(k);
+        src.width = bm.width;
+        src.height = bm.height;
+        src.data = (unsigned char*)bm.data + k * bm.width * ((bm.height + 7) >> 3);
+        dx = x;
+        dy = y;
+        sx = 0;
+        sy = 0;
+        w = bm.width;
+        h = bm.height;
+        if(!blit_clip(0, 0, _width - 1, _height - 1, bm.width, bm.height, dx, dy, sx, sy, w, h)) return;
+        bitblt(dst, dx, dy, src, sx, sy, w, h, BLT_COPY);
+    }
+    mark(dx, dy, dx + w - 1, dy + h - 1);
+}
+
+void GrayScale::cls(void)
+{
+    memset(_plane[0], 0x00, _width * _pages);
+    memset(_plane[1], 0x00, _width * _pages);
+    mark(0, 0, _width - 1, _height - 1);
+}
+
+PageBitmap GrayScale::get_plane(int k)
+{
+    PageBitmap pb;
+
+    pb.width = _width;
+    pb.height = _height;
+    pb.data = _plane[k & 1];
+    return pb;
+}
+
+void GrayScale::start(float rate)
+{
+    _ticker.detach();
+    _phase = 0;
+    _shown = -1;                      // the whole screen is sent first
+    _sent = 0;
+    _frames = 0;
+    _bytes = 0;
+    _late = 0;
+    _ticker.attach(callback(this, &GrayScale::frame), 1.0f / rate);
+}
+
+void GrayScale::stop(void)
+{
+    _ticker.detach();
+    _phase = 0;                       // plane of weight 2
+    frame();
+}
+
+// columns x0 .. x1 of a page of plane k to the lcd
+
+void GrayScale::copy(int k, int page, int x0, int x1)
+{
+    int h = _height - 8 * page;
+
+    if(h > 8) h = 8;
+    _lcd.blit(get_plane(k), x0, 8 * page, x1 - x0 + 1, h, x0, 8 * page, BLT_COPY);
+}
+
+// the changes are taken first with the interrupts off, the main program
+// may draw meanwhile. stop() calls this from the main program, the
+// ticker from its interrupt.
+// On a change of the plane the columns where the planes differ are
+// copied too, they are found from both ends of each page.
+
+void GrayScale::frame(void)
+{
+    unsigned char lo[GRAY_PAGES], hi[GRAY_PAGES];
+    const unsigned char* p0;
+    const unsigned char* p1;
+    int k, page, x0, x1, d0, d1, any;
+    int c0, c1, c2, c3;
+#if C12832_LAYERS
+    int layer;
+#endif
+#if C12832_AUTO_UP
+    unsigned int up;
+#endif
+
+    k = (_phase == 2) ? 0 : 1;
+    _phase = (_phase == 2) ? 0 : _phase + 1;
+    _frames++;
+    if(_lcd.busy()) _late++;
+    else if(_sent) _bytes += _lcd.get_bytes_sent();   // the update of the last frame is done
+    _sent = 0;
+
+    __disable_irq();
+    for(page = 0; page < _pages; page++) {
+        lo[page] = _chg_min[page];
+        hi[page] = _chg_max[page];
+        _chg_min[page] = 128;
+        _chg_max[page] = 0;
+    }
+    __enable_irq();
+    if(_shown < 0) {
+        for(page = 0; page < _pages; page++) {
+            lo[page] = 0;
+            hi[page] = _width - 1;
+        }
+    }
+
+#if C12832_LAYERS
+    layer = _lcd.get_layer();
+    _lcd.select_layer(_layer);        // taken by the constructor, only switched here
+#endif
+#if C12832_AUTO_UP
+    up = _lcd.get_auto_up();
+    _lcd.set_auto_up(0);
+#endif
+    _lcd.get_clip(c0, c1, c2, c3);
+    _lcd.reset_clip();
+    any = 0;
+    for(page = 0; page < _pages; page++) {
+        x0 = lo[page];
+        x1 = hi[page];
+        if(k != _shown) {
+            p0 = &_plane[0][page * _width];
+            p1 = &_plane[1][page * _width];
+            for(d0 = 0; d0 < _width && p0[d0] == p1[d0]; d0++);
+            if(d0 < _width) {
+                for(d1 = _width - 1; p0[d1] == p1[d1]; d1--);
+                if(d0 < x0) x0 = d0;
+                if(d1 > x1) x1 = d1;
+            }
+        }
+        if(x0 <= x1) {
+            copy(k, page, x0, x1);
+            any = 1;
+        }
+    }
+    _shown = k;
+    _lcd.set_clip(c0, c1, c2, c3);
+#if C12832_AUTO_UP
+    _lcd.set_auto_up(up);
+#endif
+#if C12832_LAYERS
+    _lcd.select_layer(layer);
+#endif
+    if(any) {
+        _lcd.flush_async();
+        _sent = 1;
+    }
+}
+
+unsigned int GrayScale::get_frames(void)
+{
+    return _frames;
+}
+
+unsigned int GrayScale::get_bytes_sent(void)
+{
+    return _bytes;
+}
+
+unsigned int GrayScale::get_late(void)
+{
+    return _late;
+}
+
+#endif
@@ -0,0 +1,172 @@
+/* 2 bit gray levels for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * The panel has 1 bit per pixel. GrayScale keeps two bit planes of
+ * weight 1 and 2 and shows them in turn from a Ticker, 3 frames a
+ * cycle : plane 2, plane 2, plane 1. A pixel is on in 0, 1, 2 or 3 of
+ * the 3 frames, the slow liquid crystal makes 4 gray levels of it.
+ *
+ * Only the columns where the planes differ and the columns drawn on
+ * since the last frame are copied to the lcd, then sent by
+ * flush_async(). Plane 2 follows plane 2 without a transfer, so a
+ * cycle costs two updates of the gray columns.
+ *
+ * SPI load, from tools/host/bench_gray : a full update by copy_to_lcd()
+ * is 4 * (3 + 128) = 524 bytes in 8 CS cycles, 210 us on a 20 MHz SPI.
+ * Per frame in the mean of a cycle :
+ *   whole screen gray    349 bytes, 5.3 CS cycles
+ *   4 bands of levels    179 bytes, 5.3 CS cycles
+ *   gauge of 128 x 8     131 bytes, 2 CS cycles, drawn every frame
+ * GRAY_RATE 150 frames/s is a cycle of 50 Hz, the lowest without
+ * flicker : the whole screen gray is 52 kB/s, 2 % of the SPI.
+ * Without DMA flush_async() sends in the interrupt, about 21 ms a
+ * second for the whole screen gray. On the STM32F4 the pages go by
+ * DMA, the interrupt only copies the planes.
+ *
+ * The planes have the size of the screen when the object is made, set
+ * the orientation before. While the refresher runs the lcd is updated
+ * from the interrupt, the program draws through this object only.
+ * Text that does not change can be put on another layer before start().
+ *
+ * needs C12832_BITMAPS, the layer is not used without C12832_LAYERS
+ *
+ * @code
+ * C12832 lcd(D11, D13, D12, D7, D10);
+ * GrayScale gray(lcd);
+ *
+ * gray.start();
+ * while(1) {
+ *     gray.fillrect(0, 24, 127, 31, 0);
+ *     gray.fillrect(0, 24, level * 127 / 100, 31, 2);   // gauge in mid gray
+ *     wait(0.1);
+ * }
+ * @endcode
+ */
+
+#ifndef GRAYSCALE_H
+#define GRAYSCALE_H
+
+#include "C12832.h"
+
+#if C12832_BITMAPS
+
+#define GRAY_RATE  150.0f   // frames per second, 3 frames a cycle
+
+/** GrayBitmap
+  * two page bitmaps of the same size one after the other,
+  * first the plane of weight 1, then the plane of weight 2
+  */
+struct GrayBitmap {
+    int width;
+    int height;
+    const unsigned char* data;
+};
+
+class GrayScale
+{
+public:
+    /** Create the gray planes for a C12832
+      *
+      * @param lcd display
+      * @param layer layer the frames are drawn on
+      */
+    GrayScale(C12832& lcd, int layer = LAYER_CONTENT);
+
+    ~GrayScale();
+
+    /** set a pixel
+      *
+      * @param x,y position on the screen
+      * @param level 0 off .. 3 black
+      */
+    void pixel(int x, int y, int level);
+
+    /** fill a rectangle
+      *
+      * @param x0,y0 top left corner
+      * @param x1,y1 down right corner
+      * @param level 0 off .. 3 black
+      */
+    void fillrect(int x0, int y0, int x1, int y1, int level);
+
+    /** copy a gray bitmap
+      *
+      * @param bm bitmap with both planes
+      * @param x,y top left corner
+      */
+    void image(const GrayBitmap& bm, int x, int y);
+
+    /** clear both planes
+      *
+      */
+    void cls(void);
+
+    /** get a plane to draw on it with bitblt()
+      *
+      * @param k 0 : weight 1, 1 : weight 2
+      * call changed() for the rectangle drawn on
+      */
+    PageBitmap get_plane(int k);
+
+    /** mark a rectangle of the planes as changed
+      *
+      */
+    void changed(int x0, int y0, int x1, int y1);
+
+    /** start the refresher
+      *
+      * @param rate frames per second
+      */
+    void start(float rate = GRAY_RATE);
+
+    /** stop the refresher, plane 2 stays on the screen
+      *
+      */
+    void stop(void);
+
+    /** show the next frame, called by the Ticker
+      *
+      */
+    void frame(void);
+
+    /** get the number of frames shown since start()
+      *
+      */
+    unsigned int get_frames(void);
+
+    /** get the bytes sent to the lcd since start()
+      *
+      * bytes * rate / frames is the SPI load in bytes per second.
+      * The update of a frame is counted at the next frame, not if late.
+      */
+    unsigned int get_bytes_sent(void);
+
+    /** get the number of frames started while the last update was still sent
+      *
+      */
+    unsigned int get_late(void);
+
+protected:
+    void mark(int x0, int y0, int x1, int y1);
+    void copy(int k, int page, int x0, int x1);
+
+    C12832& _lcd;
+    int _layer;
+    int _width;
+    int _height;
+    int _pages;
+    unsigned char* _plane[2];     // page layout of the screen
+    unsigned char* _chg_min;      // drawn columns per page since the last frame
+    unsigned char* _chg_max;
+    int _phase;                   // frame in the cycle, 0 and 1 plane 2, 2 plane 1
+    int _shown;                   // plane on the screen, -1 = none
+    int _sent;                    // the last frame started an update
+    volatile unsigned int _frames;
+    volatile unsigned int _bytes;
+    volatile unsigned int _late;
+    Ticker _ticker;
+};
+
+#endif
+
+#endif
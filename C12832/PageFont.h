@@ -0,0 +1,53 @@
+/* page font format for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * The glyphs are stored in the page layout of the LCD controller :
+ * one byte holds 8 vertical pixel of a column, bit 0 is the top row.
+ * Drawing a char is a masked copy of ready made bytes, no bit is
+ * moved at runtime if the font holds the 8 shifted variants.
+ *
+ * byte 0     0x00 (a GLCD Font Creator font starts with the bytes / char)
+ * byte 1     'P'
+ * byte 2     first char
+ * byte 3     last char
+ * byte 4     height in pixel
+ * byte 5     width of the char cell in pixel
+ * byte 6     bytes per column
+ * byte 7     number of variants, 1 or 8
+ * byte 8..   advance of each char in pixel
+ * then the glyph data : variant, char, column, byte of the column
+ *
+ * variant s holds the glyphs moved down by s rows, a char drawn at
+ * row y uses variant y % 8. Fonts with one variant are shifted
+ * while drawing.
+ *
+ * packed font, byte 1 'Z' : the header and the advance as above,
+ * 1 variant, then
+ * - the offset of every 16th glyph in the glyph data, 2 bytes low first
+ * - the glyphs, each cut to its used columns and rows :
+ *     lead << 4 | columns     empty columns on the left, used columns
+ *     top << 4 | (rows - 1)   empty rows on top, used rows
+ *     columns * rows bits, column by column, bit 0 of a byte first
+ *   an empty glyph is only the first byte, 0
+ * The glyphs are decoded when drawn and kept in a small cache,
+ * see GLYPH_CACHE in C12832_config.h. The cell is up to 15 x 16 pixel.
+ *
+ * The fonts are made with tools/fontconv from GLCD Font Creator
+ * arrays or 8x8 row fonts.
+ */
+
+#ifndef PAGEFONT_H
+#define PAGEFONT_H
+
+#define PF_MAGIC        0x00
+#define PF_ID           'P'
+#define PF_PACKED       'Z'
+#define PF_FIRST        2
+#define PF_LAST         3
+#define PF_HEIGHT       4
+#define PF_WIDTH        5
+#define PF_STRIDE       6
+#define PF_VARIANTS     7
+#define PF_HEADER       8
+
+#endif
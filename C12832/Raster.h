@@ -0,0 +1,105 @@
+/* raster core of the mbed Lab Board 128*32 pixel LCD library
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * The draw mode and the orientation are template parameters, so the
+ * inner loops of the primitives compile to shifts and masks on the
+ * framebuffer without branches or virtual calls. C12832 selects the
+ * instance at runtime once per primitive, see dispatch().
+ * The primitives are clipped before they reach the raster, plot()
+ * does not check the position.
+ *
+ * framebuffer : 4 pages of 128 bytes, bit 0 of a byte is the top row
+ */
+
+#ifndef RASTER_H
+#define RASTER_H
+
+/** draw mode policies
+  * on() : change the pixel in m
+  * bitmaps have their own raster ops, see Blit.h
+  */
+struct ModeSet {                  // NORMAL, colour 1
+    static inline void on(unsigned char& b, unsigned char m)  { b |= m; }
+};
+
+struct ModeClear {                // NORMAL, colour 0
+    static inline void on(unsigned char& b, unsigned char m)  { b &= ~m; }
+};
+
+struct ModeXor {                  // XOR, colour 1
+    static inline void on(unsigned char& b, unsigned char m)  { b ^= m; }
+};
+
+/** orientation policies
+  * map the screen position x,y to the panel position px,py
+  * W,H : size of the screen in this orientation
+  * orientation 2 and 3 are 0 and 1 turned by the controller,
+  * the buffer has the same layout, see C12832::set_orientation()
+  */
+struct Rot0 {                     // portrait
+    enum {W = 32, H = 128};
+    static inline int px(int, int y) { return 127 - y; }
+    static inline int py(int x, int) { return x; }
+};
+
+struct Rot1 {                     // landscape, panel layout
+    enum {W = 128, H = 32};
+    static inline int px(int x, int) { return x; }
+    static inline int py(int, int y) { return y; }
+};
+
+/** clip rectangle on the screen, the corners are inside
+  */
+struct Clip {
+    int x0, y0, x1, y1;
+
+    inline bool inside(int x, int y) const {
+        return x >= x0 && x <= x1 && y >= y0 && y <= y1;
+    }
+
+    // Cohen-Sutherland outcode : 1 left, 2 right, 4 above, 8 below
+    inline int outcode(int x, int y) const {
+        int c = 0;
+        if(x < x0) c |= 1;
+        else if(x > x1) c |= 2;
+        if(y < y0) c |= 4;
+        else if(y > y1) c |= 8;
+        return c;
+    }
+};
+
+template <class Mode, class Rot> struct Raster {
+    enum {W = Rot::W, H = Rot::H};
+    unsigned char* buf;
+
+    Raster(unsigned char* b) : buf(b) {}
+
+    // no check, x,y has to be on the screen
+    inline void plot(int x, int y) const {
+        int px = Rot::px(x, y);
+        int py = Rot::py(x, y);
+        Mode::on(buf[px + ((py >> 3) << 7)], 1 << (py & 7));
+    }
+};
+
+/** select the raster for mode / colour and orientation and run op(raster)
+  *
+  * op is a function object with a template operator()(R r)
+  */
+template <class Rot, class Op> static void dispatch_mode(unsigned char* buf, int mode, int colour, Op& op)
+{
+    if(mode == 0) {                   // NORMAL
+        if(colour == 0) op(Raster<ModeClear, Rot>(buf));
+        else op(Raster<ModeSet, Rot>(buf));
+    } else if(colour == 1) {          // XOR, 0 changes nothing
+        op(Raster<ModeXor, Rot>(buf));
+    }
+}
+
+template <class Op> static void dispatch(unsigned char* buf, int orientation, int mode, int colour, Op& op)
+{
+    if(orientation & 1) dispatch_mode<Rot1>(buf, mode, colour, op);
+    else dispatch_mode<Rot0>(buf, mode, colour, op);
+}
+
+#endif
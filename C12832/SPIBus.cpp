@@ -0,0 +1,136 @@
+/* shared SPI bus for the C12832 and other SPI devices
+ * Released under the MIT License: http://mbed.org/license/mit
+ */
+
+// 16.10.26    initial design
+
+#include "SPIBus.h"
+
+SPIDevice::SPIDevice(SPIBus& bus, PinName cs, int bits, int mode, int hz)
+    : _bus(bus), _cs(NULL), _bits(bits), _mode(mode), _hz(hz), _next(NULL)
+{
+    if(cs != NC) _cs = new DigitalOut(cs, 1);
+}
+
+SPIDevice::~SPIDevice()
+{
+    if(_cs != NULL) delete _cs;
+}
+
+void SPIDevice::lock(void)
+{
+    for(;;) {
+        __disable_irq();
+        if(!_bus._taken) {            // a queue is only there while the bus is taken
+            _bus._taken = 1;
+            __enable_irq();
+            break;
+        }
+        __enable_irq();
+    }
+    _bus.setup(this);
+}
+
+void SPIDevice::unlock(void)
+{
+    _bus.give();
+}
+
+bool SPIDevice::request(Callback<void()> func)
+{
+    __disable_irq();
+    if(!_bus._taken) {
+        _bus._taken = 1;
+        __enable_irq();
+        _bus.setup(this);
+        func();
+        return true;
+    }
+    _func = func;
+    _next = NULL;
+    if(_bus._last != NULL) _bus._last->_next = this;
+    else _bus._first = this;
+    _bus._last = this;
+    __enable_irq();
+    return false;
+}
+
+void SPIDevice::transfer(const uint8_t* tx, uint8_t* rx, size_t n)
+{
+    size_t i;
+    int v;
+
+    lock();
+    if(_cs != NULL) *_cs = 0;
+    for(i = 0; i < n; i++) {
+        v = _bus._spi.write(tx ? tx[i] : 0xFF);
+        if(rx) rx[i] = v;
+    }
+    if(_cs != NULL) *_cs = 1;
+    unlock();
+}
+
+SPIBus& SPIDevice::bus(void)
+{
+    return _bus;
+}
+
+SPIBus::SPIBus(PinName mosi, PinName miso, PinName sck)
+    : _spi(mosi, miso, sck), _mosi(mosi), _taken(0), _first(NULL), _last(NULL),
+      _bits(0), _mode(0), _hz(0), _switches(0)
+{
+}
+
+SPI& SPIBus::spi(void)
+{
+    return _spi;
+}
+
+PinName SPIBus::get_mosi(void)
+{
+    return _mosi;
+}
+
+bool SPIBus::busy(void)
+{
+    return _taken != 0;
+}
+
+unsigned int SPIBus::get_switches(void)
+{
+    return _switches;
+}
+
+// format and clock of the device, only if another one was set
+
+void SPIBus::setup(SPIDevice* d)
+{
+    if(d->_bits == _bits && d->_mode == _mode && d->_hz == _hz) return;
+    _spi.format(d->_bits, d->_mode);
+    _spi.frequency(d->_hz);
+    _bits = d->_bits;
+    _mode = d->_mode;
+    _hz = d->_hz;
+    _switches++;
+}
+
+// the bus goes to the first queued device without being free in between,
+// else it is free
+
+void SPIBus::give(void)
+{
+    SPIDevice* d;
+
+    __disable_irq();
+    d = _first;
+    if(d == NULL) {
+        _taken = 0;
+        __enable_irq();
+        return;
+    }
+    _first = d->_next;
+    if(_first == NULL) _last = NULL;
+    __enable_irq();
+    setup(d);
+    d->_func();
+}
@@ -0,0 +1,149 @@
+/* shared SPI bus for the C12832 and other SPI devices
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * An SPIBus owns the SPI of the pins, each device on it is an SPIDevice
+ * with its own chip select, format and clock. A device takes the bus
+ * for a transaction, the bus is set up for it only if the device before
+ * had another format or clock. Two panels with the same settings share
+ * the bus without any change.
+ *
+ * lock() waits for the bus in the main program. request() is for
+ * transfers that run on in interrupts, like the DMA update of the
+ * C12832 on the STM32F4 : the function starts at once if the bus is
+ * free, else it is queued and started when the device before gives the
+ * bus back. The devices take turns in the order of their requests, so
+ * the passes of two panels follow each other without a gap.
+ *
+ * @code
+ * SPIBus bus(D11, D12, D13);
+ * C12832 lcd1(bus, D6, D7, D10);
+ * C12832 lcd2(bus, D3, D7, D9);        // A0 can be shared, CS not
+ * SPIDevice flash(bus, D8, 8, 0, 10000000);
+ *
+ * lcd1.flush_async();
+ * lcd2.flush_async();                  // sent after the pass of lcd1
+ * flash.transfer(cmd, id, 4);          // waits for both passes
+ * @endcode
+ */
+
+#ifndef SPIBUS_H
+#define SPIBUS_H
+
+#include "mbed.h"
+
+class SPIBus;
+
+class SPIDevice
+{
+public:
+    /** Create a device on a bus
+      *
+      * @param bus SPI bus
+      * @param cs chip select, low active, NC if the device sets it itself
+      * @param bits bits per frame
+      * @param mode SPI mode 0..3
+      * @param hz clock
+      */
+    SPIDevice(SPIBus& bus, PinName cs, int bits = 8, int mode = 0, int hz = 1000000);
+
+    ~SPIDevice();
+
+    /** take the bus, waits while another device has it
+      *
+      * not from interrupts, the bus may be held by the main program
+      */
+    void lock(void);
+
+    /** give the bus back, a queued request starts now
+      *
+      */
+    void unlock(void);
+
+    /** start a function with the bus taken
+      *
+      * at once if the bus is free, else when the devices before are done,
+      * then from their unlock(). The function calls unlock() at the end
+      * of its transfer. One request per device at a time.
+      *
+      * @param func started with the bus taken
+      * @returns true if started at once
+      */
+    bool request(Callback<void()> func);
+
+    /** send and receive n bytes with chip select low, blocking
+      *
+      * takes the bus by lock() and writes byte by byte with SPI::write(),
+      * not from interrupts. There is no DMA here, a device that streams
+      * from an interrupt uses request() like the C12832.
+      *
+      * @param tx bytes to send, NULL sends 0xFF
+      * @param rx received bytes, NULL drops them
+      * @param n number of bytes
+      */
+    void transfer(const uint8_t* tx, uint8_t* rx, size_t n);
+
+    /** get the bus of the device
+      *
+      */
+    SPIBus& bus(void);
+
+private:
+    friend class SPIBus;
+
+    SPIBus& _bus;
+    DigitalOut* _cs;              // NULL = set by the device
+    int _bits;
+    int _mode;
+    int _hz;
+    Callback<void()> _func;       // queued request
+    SPIDevice* _next;             // next in the queue of the bus
+};
+
+class SPIBus
+{
+public:
+    /** Create a bus
+      *
+      * @param mosi,miso,sck pins of the SPI, miso can be NC
+      */
+    SPIBus(PinName mosi, PinName miso, PinName sck);
+
+    /** get the SPI, for the device that has the bus
+      *
+      */
+    SPI& spi(void);
+
+    /** get the mosi pin, it tells the SPI peripheral
+      *
+      */
+    PinName get_mosi(void);
+
+    /** check if a device has the bus
+      *
+      */
+    bool busy(void);
+
+    /** get the number of changes of format or clock
+      *
+      * @returns changes since the bus was created
+      */
+    unsigned int get_switches(void);
+
+private:
+    friend class SPIDevice;
+
+    void setup(SPIDevice* d);
+    void give(void);
+
+    SPI _spi;
+    PinName _mosi;
+    volatile int _taken;          // a device has the bus
+    SPIDevice* _first;            // queue of requests
+    SPIDevice* _last;
+    int _bits;                    // format and clock set now, 0 = none
+    int _mode;
+    int _hz;
+    unsigned int _switches;
+};
+
+#endif
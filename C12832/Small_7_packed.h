@@ -0,0 +1,116 @@
+// generated by tools/fontconv from Small_7.h, do not edit
+// packed font, see PageFont.h
+
+#ifndef small_7_packed
+#define small_7_packed
+
+const unsigned char Small_7_packed[] = {
+        0x00, 'Z', 32, 127, 9, 9, 2, 1,        // magic, first, last, height, width, bytes/column, variants
+        // advance
+        5, 2, 4, 6, 6, 7, 7, 2, 3, 3, 4, 5, 2, 4, 2, 4,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2, 5, 5, 5, 5,
+        9, 6, 6, 6, 6, 5, 5, 6, 6, 2, 4, 5, 5, 8, 6, 6,
+        5, 7, 5, 5, 6, 6, 7, 6, 6, 6, 6, 3, 4, 2, 4, 6,
+        3, 5, 5, 5, 5, 5, 4, 5, 5, 2, 2, 5, 2, 6, 5, 5,
+        5, 5, 4, 4, 4, 5, 4, 6, 5, 5, 5, 4, 3, 4, 5, 3,
+        // offset of every 16th glyph
+        0x00, 0x00, 0x4C, 0x00, 0xA3, 0x00, 0x0E, 0x01, 0x72, 0x01, 0xC1, 0x01,
+        0x00,  // Code for char  
+        0x11, 0x16, 0x4F,  // Code for char !
+        0x13, 0x11, 0x33,  // Code for char "
+        0x15, 0x34, 0xEA, 0xAB, 0xAF, 0x00,  // Code for char #
+        0x15, 0x17, 0x46, 0x49, 0xFF, 0x51, 0x20,  // Code for char $
+        0x07, 0x16, 0x8F, 0xE4, 0x0B, 0xC2, 0x57, 0xE6, 0x01,  // Code for char %
+        0x16, 0x16, 0xB2, 0x66, 0xD5, 0x0C, 0x03, 0x02,  // Code for char &
+        0x11, 0x11, 0x03,  // Code for char '
+        0x12, 0x08, 0x7C, 0x06, 0x03,  // Code for char (
+        0x12, 0x08, 0x83, 0xF9, 0x00,  // Code for char )
+        0x13, 0x33, 0xF6, 0x06,  // Code for char *
+        0x05, 0x24, 0x84, 0x7C, 0x42, 0x00,  // Code for char +
+        0x02, 0x62, 0x1C,  // Code for char ,
+        0x13, 0x40, 0x07,  // Code for char -
+        0x11, 0x70, 0x01,  // Code for char .
+        0x04, 0x08, 0x00, 0xC1, 0x71, 0x18, 0x00,  // Code for char /
+        0x14, 0x16, 0xBE, 0x60, 0xD0, 0x07,  // Code for char 0
+        0x13, 0x16, 0x04, 0xC1, 0x1F,  // Code for char 1
+        0x14, 0x16, 0xC2, 0x70, 0xD4, 0x09,  // Code for char 2
+        0x14, 0x16, 0xC1, 0x64, 0xD2, 0x06,  // Code for char 3
+        0x14, 0x16, 0x1C, 0x4B, 0xE4, 0x0F,  // Code for char 4
+        0x14, 0x16, 0xCF, 0x64, 0x32, 0x06,  // Code for char 5
+        0x14, 0x16, 0xBE, 0x64, 0x52, 0x07,  // Code for char 6
+        0x14, 0x16, 0x81, 0x70, 0xE6, 0x00,  // Code for char 7
+        0x14, 0x16, 0xB6, 0x64, 0xD2, 0x06,  // Code for char 8
+        0x14, 0x16, 0xCE, 0x64, 0xD2, 0x07,  // Code for char 9
+        0x11, 0x34, 0x11,  // Code for char :
+        0x02, 0x35, 0x60, 0x06,  // Code for char ;
+        0x05, 0x24, 0x84, 0x28, 0x15, 0x01,  // Code for char <
+        0x14, 0x32, 0x6D, 0x0B,  // Code for char =
+        0x14, 0x24, 0x51, 0x29, 0x02,  // Code for char >
+        0x14, 0x16, 0x81, 0x6C, 0xC2, 0x00,  // Code for char ?
+        0x18, 0x17, 0x7C, 0xC2, 0xB9, 0xA5, 0xA5, 0xBD, 0x21, 0x1E,  // Code for char @
+        0x15, 0x16, 0x7C, 0x49, 0x44, 0xC2, 0x07,  // Code for char A
+        0x15, 0x16, 0xFF, 0x64, 0x32, 0x69, 0x03,  // Code for char B
+        0x15, 0x16, 0xBE, 0x60, 0x30, 0x28, 0x02,  // Code for char C
+        0x15, 0x16, 0xFF, 0x60, 0x70, 0xEC, 0x03,  // Code for char D
+        0x14, 0x16, 0xFF, 0x64, 0x32, 0x09,  // Code for char E
+        0x14, 0x16, 0xFF, 0x44, 0x22, 0x01,  // Code for char F
+        0x15, 0x16, 0xBE, 0x71, 0x30, 0xB9, 0x07,  // Code for char G
+        0x15, 0x16, 0x7F, 0x04, 0x02, 0xF1, 0x07,  // Code for char H
+        0x11, 0x16, 0x7F,  // Code for char I
+        0x13, 0x16, 0x40, 0xE0, 0x0F,  // Code for char J
+        0x14, 0x16, 0x7F, 0x84, 0x25, 0x0C,  // Code for char K
+        0x14, 0x16, 0x7F, 0x20, 0x10, 0x08,  // Code for char L
+        0x17, 0x16, 0xFF, 0x01, 0x03, 0xCE, 0x18, 0xFC, 0x01,  // Code for char M
+        0x15, 0x16, 0xFF, 0x01, 0x03, 0xF6, 0x07,  // Code for char N
+        0x15, 0x16, 0xBE, 0x60, 0x30, 0xE8, 0x03,  // Code for char O
+        0x14, 0x16, 0xFF, 0x44, 0xC2, 0x00,  // Code for char P
+        0x16, 0x17, 0x3E, 0x41, 0x41, 0x61, 0x7E, 0x80,  // Code for char Q
+        0x14, 0x16, 0xFF, 0x44, 0xC2, 0x0E,  // Code for char R
+        0x14, 0x16, 0xE6, 0x64, 0x72, 0x06,  // Code for char S
+        0x15, 0x16, 0x81, 0xC0, 0x3F, 0x10, 0x00,  // Code for char T
+        0x15, 0x16, 0x3F, 0x20, 0x10, 0xF8, 0x03,  // Code for char U
+        0x16, 0x16, 0x03, 0x0F, 0x1C, 0xEE, 0x18, 0x00,  // Code for char V
+        0x15, 0x16, 0x0F, 0xF8, 0x07, 0xFE, 0x00,  // Code for char W
+        0x15, 0x16, 0x41, 0x19, 0xC7, 0x16, 0x04,  // Code for char X
+        0x15, 0x16, 0x01, 0x03, 0xDE, 0x10, 0x00,  // Code for char Y
+        0x15, 0x16, 0xC1, 0x78, 0xF2, 0x18, 0x04,  // Code for char Z
+        0x12, 0x08, 0xFF, 0x03, 0x02,  // Code for char [
+        0x04, 0x08, 0x01, 0x1C, 0xC0, 0x01, 0x0C,  // Code for char \ (back slash)
+        0x02, 0x08, 0x01, 0xFF, 0x03,  // Code for char ]
+        0x13, 0x22, 0x9E, 0x01,  // Code for char ^
+        0x06, 0x80, 0x3F,  // Code for char _
+        0x12, 0x01, 0x09,  // Code for char `
+        0x14, 0x34, 0xBD, 0xD6, 0x0F,  // Code for char a
+        0x14, 0x16, 0x7F, 0x22, 0x11, 0x07,  // Code for char b
+        0x14, 0x34, 0x2E, 0xC6, 0x08,  // Code for char c
+        0x14, 0x16, 0x38, 0x22, 0xF1, 0x0F,  // Code for char d
+        0x14, 0x34, 0xAE, 0x56, 0x0B,  // Code for char e
+        0x04, 0x16, 0x84, 0x7F, 0x21, 0x00,  // Code for char f
+        0x14, 0x35, 0x46, 0x9A, 0xFE,  // Code for char g
+        0x14, 0x16, 0x7F, 0x02, 0x81, 0x0F,  // Code for char h
+        0x11, 0x16, 0x7D,  // Code for char i
+        0x02, 0x17, 0x80, 0xFD,  // Code for char j
+        0x14, 0x16, 0x7F, 0x08, 0x8A, 0x08,  // Code for char k
+        0x11, 0x16, 0x7F,  // Code for char l
+        0x15, 0x34, 0x3F, 0xFC, 0xF0, 0x01,  // Code for char m
+        0x14, 0x34, 0x3F, 0x84, 0x0F,  // Code for char n
+        0x14, 0x34, 0x2E, 0x46, 0x07,  // Code for char o
+        0x14, 0x35, 0x7F, 0x92, 0x18,  // Code for char p
+        0x14, 0x35, 0x46, 0x92, 0xFC,  // Code for char q
+        0x13, 0x34, 0x3F, 0x04,  // Code for char r
+        0x13, 0x34, 0xB3, 0x76,  // Code for char s
+        0x13, 0x25, 0xC2, 0x2F, 0x02,  // Code for char t
+        0x14, 0x34, 0x0F, 0xC2, 0x0F,  // Code for char u
+        0x13, 0x34, 0x07, 0x1F,  // Code for char v
+        0x15, 0x34, 0x0F, 0x1F, 0xFC, 0x00,  // Code for char w
+        0x14, 0x34, 0xD1, 0xB9, 0x08,  // Code for char x
+        0x14, 0x35, 0x07, 0x8A, 0x7E,  // Code for char y
+        0x14, 0x34, 0xB9, 0xDF, 0x08,  // Code for char z
+        0x04, 0x08, 0x10, 0x70, 0xBC, 0x0F, 0x08,  // Code for char {
+        0x21, 0x08, 0xFF, 0x01,  // Code for char |
+        0x04, 0x08, 0x01, 0x8F, 0xE3, 0x80, 0x00,  // Code for char }
+        0x05, 0x21, 0xB7, 0x03,  // Code for char ~
+        0x03, 0x17, 0xFF, 0x81, 0xFF   // Code for char  
+        };
+
+#endif
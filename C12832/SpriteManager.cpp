@@ -0,0 +1,230 @@
+/* sprites for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ */
+
+// 16.10.26    initial design
+
+#include "SpriteManager.h"
+
+#if C12832_BITMAPS
+
+SpriteManager::SpriteManager(C12832& lcd, int layer)
+    : _lcd(lcd), _layer(layer), _pixels(0)
+{
+    int i;
+
+    for(i = 0; i < SPRITE_MAX; i++) {
+        _sprite[i].used = 0;
+        _sprite[i].shown = 0;
+        _sprite[i].changed = 0;
+        _sprite[i].z = 0;
+        _sprite[i].shown_z = 0;
+        _sprite[i].save = NULL;
+        _sprite[i].save_size = 0;
+    }
+}
+
+SpriteManager::~SpriteManager()
+{
+    int i;
+
+    for(i = 0; i < SPRITE_MAX; i++) {
+        if(_sprite[i].save != NULL) delete[] _sprite[i].save;
+    }
+}
+
+int SpriteManager::valid(int id)
+{
+    return id >= 0 && id < SPRITE_MAX && _sprite[id].used;
+}
+
+int SpriteManager::add(const Bitmap& bm, int x, int y, int z, int mode)
+{
+    int i;
+
+    for(i = 0; i < SPRITE_MAX; i++) {
+        if(!_sprite[i].used && !_sprite[i].shown) break;   // free and taken away
+    }
+    if(i == SPRITE_MAX) return -1;
+    _sprite[i].bm = &bm;
+    _sprite[i].x = x;
+    _sprite[i].y = y;
+    _sprite[i].z = z;
+    _sprite[i].mode = mode;
+    _sprite[i].used = 1;
+    _sprite[i].visible = 1;
+    _sprite[i].changed = 1;
+    return i;
+}
+
+void SpriteManager::remove(int id)
+{
+    if(!valid(id)) return;
+    _sprite[id].used = 0;
+    _sprite[id].visible = 0;
+    _sprite[id].changed = 1;
+}
+
+void SpriteManager::move(int id, int x, int y)
+{
+    if(!valid(id)) return;
+    if(_sprite[id].x == x && _sprite[id].y == y) return;
+    _sprite[id].x = x;
+    _sprite[id].y = y;
+    _sprite[id].changed = 1;
+}
+
+void SpriteManager::set_bitmap(int id, const Bitmap& bm)
+{
+    if(!valid(id)) return;
+    _sprite[id].bm = &bm;
+    _sprite[id].changed = 1;
+}
+
+void SpriteManager::set_z(int id, int z)
+{
+    if(!valid(id) || _sprite[id].z == z) return;
+    _sprite[id].z = z;
+    _sprite[id].changed = 1;
+}
+
+void SpriteManager::show(int id, unsigned int on)
+{
+    if(!valid(id) || _sprite[id].visible == (on != 0)) return;
+    _sprite[id].visible = (on != 0);
+    _sprite[id].changed = 1;
+}
+
+unsigned int SpriteManager::get_pixels_drawn(void)
+{
+    return _pixels;
+}
+
+int SpriteManager::overlap(const Bitmap* a, int ax, int ay, const Bitmap* b, int bx, int by)
+{
+    return ax < bx + b->xSize && bx < ax + a->xSize && ay < by + b->ySize && by < ay + a->ySize;
+}
+
+// numbers of the sprites, lowest z first
+// shown = 1 : z on the screen, else the new z
+
+void SpriteManager::order(int* list, int shown)
+{
+    int i, j, z;
+
+    for(i = 0; i < SPRITE_MAX; i++) {
+        z = shown ? _sprite[i].shown_z : _sprite[i].z;
+        for(j = i; j > 0 && (shown ? _sprite[list[j - 1]].shown_z : _sprite[list[j - 1]].z) > z; j--) list[j] = list[j - 1];
+        list[j] = i;
+    }
+}
+
+// put the pixel underneath back, xor sprites are drawn again
+
+void SpriteManager::take_away(Sprite& s)
+{
+    PageBitmap pb;
+    int w = s.shown_bm->xSize;
+    int h = s.shown_bm->ySize;
+
+    if(s.mode == SPRITE_XOR) {
+        _lcd.blit(*s.shown_bm, 0, 0, w, h, s.shown_x, s.shown_y, BLT_XOR);
+    } else {
+        pb.width = w;
+        pb.height = h;
+        pb.data = s.save;
+        _lcd.blit(pb, 0, 0, w, h, s.shown_x, s.shown_y, BLT_COPY);
+    }
+    _pixels += w * h;
+    s.shown = 0;
+}
+
+// save the pixel underneath and draw the sprite
+
+void SpriteManager::put(Sprite& s)
+{
+    PageBitmap pb;
+    int w = s.bm->xSize;
+    int h = s.bm->ySize;
+    int size = w * ((h + 7) >> 3);
+
+    if(s.mode != SPRITE_XOR) {
+        if(size > s.save_size) {
+            if(s.save != NULL) delete[] s.save;
+            s.save = new unsigned char[size];
+            s.save_size = size;
+        }
+        pb.width = w;
+        pb.height = h;
+        pb.data = s.save;
+        _lcd.get_area(pb, s.x, s.y, w, h);
+    }
+    _lcd.blit(*s.bm, 0, 0, w, h, s.x, s.y, s.mode == SPRITE_XOR ? BLT_XOR : (s.mode == SPRITE_OR ? BLT_OR : BLT_COPY));
+    _pixels += w * h;
+    s.shown_bm = s.bm;
+    s.shown_x = s.x;
+    s.shown_y = s.y;
+    s.shown_z = s.z;
+    s.shown = 1;
+}
+
+// the changed sprites are taken away from the top down and drawn again
+// from the bottom up. A sprite that overlaps one of them at the old or
+// the new place has to follow, else it would be cut or buried.
+
+void SpriteManager::draw(void)
+{
+    unsigned char redo[SPRITE_MAX];
+    int list[SPRITE_MAX];
+    int i, j, k, more;
+#if C12832_LAYERS
+    int layer;
+#endif
+    Sprite* a;
+    Sprite* b;
+
+    for(i = 0; i < SPRITE_MAX; i++) {
+        redo[i] = (_sprite[i].used || _sprite[i].shown) && _sprite[i].changed;
+    }
+    do {
+        more = 0;
+        for(j = 0; j < SPRITE_MAX; j++) {
+            b = &_sprite[j];
+            if(redo[j] || !b->shown) continue;
+            for(i = 0; i < SPRITE_MAX; i++) {
+                if(!redo[i]) continue;
+                a = &_sprite[i];
+                if((a->shown && overlap(a->shown_bm, a->shown_x, a->shown_y, b->shown_bm, b->shown_x, b->shown_y))
+                        || (a->visible && overlap(a->bm, a->x, a->y, b->shown_bm, b->shown_x, b->shown_y))) {
+                    redo[j] = 1;
+                    more = 1;
+                    break;
+                }
+            }
+        }
+    } while(more);
+
+#if C12832_LAYERS
+    layer = _lcd.get_layer();
+    _lcd.select_layer(_layer);
+#endif
+    _lcd.begin_frame();
+    order(list, 1);
+    for(k = SPRITE_MAX - 1; k >= 0; k--) {
+        i = list[k];
+        if(redo[i] && _sprite[i].shown) take_away(_sprite[i]);
+    }
+    order(list, 0);
+    for(k = 0; k < SPRITE_MAX; k++) {
+        i = list[k];
+        if(!redo[i]) continue;
+        if(_sprite[i].visible) put(_sprite[i]);
+        _sprite[i].changed = 0;
+    }
+    _lcd.end_frame();
+#if C12832_LAYERS
+    _lcd.select_layer(layer);
+#endif
+}
+
+#endif
@@ -0,0 +1,143 @@
+/* sprites for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * A table of up to SPRITE_MAX small bitmaps on top of the framebuffer.
+ * draw() takes a sprite away from its old place and draws it at the
+ * new one, only the columns of the two rectangles are sent. Sprites
+ * above or below a changed sprite are taken away and drawn again if
+ * they overlap, so the z-order stays right.
+ *
+ * SPRITE_XOR   drawn and taken away by xor, no memory
+ * SPRITE_OR    set pixel are drawn, the pixel underneath are saved
+ * SPRITE_COPY  the whole rectangle is drawn, the pixel underneath are saved
+ *
+ * The pixel underneath are saved when the sprite is drawn, do not draw
+ * under a saved sprite while it is shown. Put the sprites on the overlay
+ * layer if the content changes under them.
+ *
+ * needs C12832_BITMAPS, the layer is not used without C12832_LAYERS
+ *
+ * @code
+ * C12832 lcd(D11, D13, D12, D7, D10);
+ * SpriteManager sprites(lcd, LAYER_OVERLAY);
+ * lcd.show_layer(LAYER_OVERLAY, 1);
+ *
+ * int hand = sprites.add(hand_bm, 60, 8);
+ * while(1) {
+ *     sprites.move(hand, x, y);
+ *     sprites.draw();          // one update for all sprites
+ * }
+ * @endcode
+ */
+
+#ifndef SPRITEMANAGER_H
+#define SPRITEMANAGER_H
+
+#include "C12832.h"
+
+#if C12832_BITMAPS
+
+#define SPRITE_MAX  8   // entries in the sprite table
+
+/** sprite mode
+  */
+enum {SPRITE_XOR, SPRITE_OR, SPRITE_COPY};
+
+class SpriteManager
+{
+public:
+    /** Create a sprite table on a C12832
+      *
+      * @param lcd display
+      * @param layer layer the sprites are drawn on
+      */
+    SpriteManager(C12832& lcd, int layer = LAYER_CONTENT);
+
+    ~SpriteManager();
+
+    /** add a sprite, shown at the next draw()
+      *
+      * @param bm bitmap, has to stay valid while the sprite is used
+      * @param x,y top left corner on the screen
+      * @param z sprites with a higher z are drawn on top
+      * @param mode SPRITE_XOR, SPRITE_OR or SPRITE_COPY
+      * @returns number of the sprite, -1 if the table is full
+      */
+    int add(const Bitmap& bm, int x, int y, int z = 0, int mode = SPRITE_XOR);
+
+    /** remove a sprite, taken away at the next draw()
+      *
+      * @param id number of the sprite
+      */
+    void remove(int id);
+
+    /** move a sprite
+      *
+      * @param id number of the sprite
+      * @param x,y new top left corner
+      */
+    void move(int id, int x, int y);
+
+    /** change the bitmap of a sprite
+      *
+      * @param id number of the sprite
+      * @param bm new bitmap
+      */
+    void set_bitmap(int id, const Bitmap& bm);
+
+    /** change the z-order of a sprite
+      *
+      * @param id number of the sprite
+      * @param z sprites with a higher z are drawn on top
+      */
+    void set_z(int id, int z);
+
+    /** show or hide a sprite
+      *
+      * @param id number of the sprite
+      * @param on 1 = show, 0 = hide
+      */
+    void show(int id, unsigned int on);
+
+    /** bring the changes of all sprites to the screen
+      *
+      * drawn as one frame
+      */
+    void draw(void);
+
+    /** get the number of pixel drawn and restored
+      *
+      * @returns sprite area handled by draw() since the table was created
+      */
+    unsigned int get_pixels_drawn(void);
+
+private:
+    struct Sprite {
+        const Bitmap* bm;            // new state
+        int x, y, z;
+        unsigned char mode;
+        unsigned char used;
+        unsigned char visible;
+        unsigned char changed;
+        const Bitmap* shown_bm;      // state on the screen
+        int shown_x, shown_y, shown_z;
+        unsigned char shown;
+        unsigned char* save;         // pixel underneath, page layout
+        int save_size;
+    };
+
+    int valid(int id);
+    void order(int* list, int shown);
+    void take_away(Sprite& s);
+    void put(Sprite& s);
+    static int overlap(const Bitmap* a, int ax, int ay, const Bitmap* b, int bx, int by);
+
+    C12832& _lcd;
+    int _layer;
+    Sprite _sprite[SPRITE_MAX];
+    unsigned int _pixels;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,164 @@
+/* rolling strip chart for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ */
+
+// 16.10.26    initial design
+
+#include "StripChart.h"
+
+StripChart::StripChart(C12832& lcd, int x, int y, int w, int h, int samples)
+    : _lcd(lcd), _x(x), _y(y), _w(w), _h(h), _lo(0.0f), _hi(1.0f), _auto(0), _all(1),
+      _samples(samples < 1 ? 1 : samples), _count(0), _cmin(0.0f), _cmax(0.0f), _prev(0.0f),
+      _head(0), _used(0), _added(0), _drawn(0), _columns(0)
+{
+    if(_w < 1) _w = 1;
+    if(_h < 1) _h = 1;
+    _min = new float[_w];
+    _max = new float[_w];
+}
+
+StripChart::~StripChart()
+{
+    delete[] _min;
+    delete[] _max;
+}
+
+void StripChart::set_range(float lo, float hi)
+{
+    _lo = lo;
+    _hi = hi;
+    _auto = 0;
+    _all = 1;
+}
+
+void StripChart::set_auto_range(void)
+{
+    _lo = 0.0f;                       // no range yet, the first draw() takes the columns
+    _hi = 0.0f;
+    _auto = 1;
+    _all = 1;
+}
+
+void StripChart::set_samples(int samples)
+{
+    __disable_irq();
+    _samples = (samples < 1) ? 1 : samples;
+    _count = 0;
+    __enable_irq();
+}
+
+// the open column takes min and max of its samples, a finished column
+// reaches back to the last sample of the column before
+
+void StripChart::add(float v)
+{
+    if(_count == 0) {
+        _cmin = v;
+        _cmax = v;
+        if(_used == 0) _prev = v;     // first column
+    } else {
+        if(v < _cmin) _cmin = v;
+        if(v > _cmax) _cmax = v;
+    }
+    if(++_count < _samples) return;
+
+    _min[_head] = (_cmin < _prev) ? _cmin : _prev;
+    _max[_head] = (_cmax > _prev) ? _cmax : _prev;
+    _prev = v;
+    _count = 0;
+    _head = (_head + 1 == _w) ? 0 : _head + 1;
+    if(_used < _w) _used++;
+    _added++;                         // last, draw() takes the column now
+}
+
+// screen row of a value, clipped to the chart
+
+int StripChart::row(float v)
+{
+    int r;
+
+    if(_hi <= _lo) return _y + _h / 2;
+    r = (int)((v - _lo) * (_h - 1) / (_hi - _lo) + 0.5f);
+    if(r < 0) r = 0;
+    if(r > _h - 1) r = _h - 1;
+    return _y + _h - 1 - r;
+}
+
+// one vertical span, data = 0 : a clear column
+
+void StripChart::column(int c, int data)
+{
+    _lcd.fillrect(_x + c, _y, _x + c, _y + _h - 1, 0);
+    if(data) _lcd.fillrect(_x + c, row(_max[c]), _x + c, row(_min[c]), 1);
+    _columns++;
+}
+
+// range of the columns with data, returns 1 if the scale has changed
+
+int StripChart::rescale(void)
+{
+    float lo, hi;
+    int c, n = _used;
+
+    if(n == 0) return 0;
+    lo = _min[0];
+    hi = _max[0];
+    for(c = 1; c < n; c++) {
+        if(_min[c] < lo) lo = _min[c];
+        if(_max[c] > hi) hi = _max[c];
+    }
+    if(lo >= _lo && hi <= _hi && 2 * (hi - lo) >= _hi - _lo) return 0;
+    _lo = lo;
+    _hi = hi;
+    return 1;
+}
+
+void StripChart::draw(void)
+{
+    unsigned int added, i, n;
+    int c, head, used;
+
+    __disable_irq();                  // a consistent view of the ring
+    added = _added;
+    head = _head;
+    used = _used;
+    __enable_irq();
+
+    n = added - _drawn;
+    if(_auto && rescale()) _all = 1;
+    if(n >= (unsigned int)_w) _all = 1;
+    if(!_all && n == 0) return;
+
+    _lcd.begin_frame();
+    if(_all) {
+        for(c = 0; c < _w; c++) column(c, c < used);
+        _all = 0;
+    } else {
+        for(i = n; i > 0; i--) column((head + _w - i) % _w, 1);
+    }
+    if(_w > 1) column(head, 0);       // the oldest column makes room, the chart goes on here
+    _lcd.end_frame();
+    _drawn = added;
+}
+
+void StripChart::clear(void)
+{
+    __disable_irq();
+    _count = 0;
+    _head = 0;
+    _used = 0;
+    _added = 0;
+    __enable_irq();
+    _drawn = 0;
+    if(_auto) {
+        _lo = 0.0f;
+        _hi = 0.0f;
+    }
+    _all = 1;
+    draw();
+}
+
+unsigned int StripChart::get_columns_drawn(void)
+{
+    return _columns;
+}
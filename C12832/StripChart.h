@@ -0,0 +1,128 @@
+/* rolling strip chart for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * One column of the chart for each sample, or for each group of
+ * samples drawn as the span from their minimum to their maximum.
+ * The columns are kept in a ring, a new column is written at the
+ * place of the oldest one and a clear column in front of it shows
+ * where the chart goes on. So a new sample draws one vertical span,
+ * nothing is shifted.
+ *
+ * add() only stores the sample, it can be called from a Ticker at
+ * hundreds of samples a second. draw() in the main loop draws the
+ * columns finished since the last call with one update of the lcd.
+ * Each column reaches back to the last sample of the column before,
+ * so the curve has no gaps.
+ *
+ * @code
+ * C12832 lcd(D11, D13, D12, D7, D10);
+ * StripChart chart(lcd, 0, 10, 128, 22, 10);  // 10 samples a column
+ * Ticker sampler;
+ *
+ * void sample() { chart.add(pot.read()); }
+ *
+ * chart.set_range(0.0f, 1.0f);
+ * sampler.attach(&sample, 0.002f);            // 500 samples a second
+ * while(1) {
+ *     chart.draw();
+ *     wait(0.1);
+ * }
+ * @endcode
+ */
+
+#ifndef STRIPCHART_H
+#define STRIPCHART_H
+
+#include "C12832.h"
+
+class StripChart
+{
+public:
+    /** Create a strip chart on a C12832
+      *
+      * @param lcd display
+      * @param x,y top left corner on the screen
+      * @param w,h size in pixel, w columns of samples
+      * @param samples samples in one column
+      */
+    StripChart(C12832& lcd, int x, int y, int w, int h, int samples = 1);
+
+    ~StripChart();
+
+    /** fixed scale
+      *
+      * @param lo value at the bottom row
+      * @param hi value at the top row
+      */
+    void set_range(float lo, float hi);
+
+    /** automatic scale
+      *
+      * the range grows at once to new values and shrinks when the
+      * columns use less than half of it
+      */
+    void set_auto_range(void);
+
+    /** set the number of samples in one column
+      *
+      * @param samples 1 : one sample a column, n : min / max of n samples
+      */
+    void set_samples(int samples);
+
+    /** add a sample, safe in an interrupt
+      *
+      * @param v value of the sample
+      */
+    void add(float v);
+
+    /** draw the columns finished since the last call
+      *
+      * all columns are drawn again if the scale has changed or more
+      * than the width of the chart has been added
+      */
+    void draw(void);
+
+    /** forget all samples and clear the chart
+      *
+      */
+    void clear(void);
+
+    /** get the number of columns drawn
+      *
+      * @returns columns drawn since the chart was created
+      */
+    unsigned int get_columns_drawn(void);
+
+private:
+    int row(float v);
+    void column(int c, int data);
+    int rescale(void);
+
+    C12832& _lcd;
+    int _x;
+    int _y;
+    int _w;
+    int _h;
+    float* _min;                  // ring of the columns, _w entries
+    float* _max;
+    float _lo;                    // value of the bottom row
+    float _hi;                    // value of the top row
+    int _auto;
+    int _all;                     // draw all columns at the next draw()
+
+    // written by add()
+    volatile int _samples;
+    volatile int _count;          // samples in the open column
+    volatile float _cmin;         // min / max of the open column
+    volatile float _cmax;
+    volatile float _prev;         // last sample of the column before
+    volatile int _head;           // column written next
+    volatile int _used;           // columns with data, up to _w
+    volatile unsigned int _added; // columns finished
+
+    // written by draw()
+    unsigned int _drawn;          // columns drawn
+    unsigned int _columns;
+};
+
+#endif
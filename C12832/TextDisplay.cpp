@@ -5,6 +5,7 @@
  
 #include "TextDisplay.h"
 
+#if C12832_STDIO
 TextDisplay::TextDisplay(const char *name) : Stream(name){
     _row = 0;
     _column = 0;
@@ -15,6 +16,13 @@ TextDisplay::TextDisplay(const char *name) : Stream(name){
         sprintf(_path, "/%s", name);
     }
 }
+#else
+// no name, the stream is not put into the file system
+TextDisplay::TextDisplay(const char *) : Stream(NULL){
+    _row = 0;
+    _column = 0;
+}
+#endif
     
 int TextDisplay::_putc(int value) {
     if(value == '\n') {
@@ -62,6 +70,7 @@ void TextDisplay::background(uint16_t colour) {
     _background = colour;
 }
 
+#if C12832_STDIO
 bool TextDisplay::claim (FILE *stream) {
     if ( _path == NULL) {
         fprintf(stderr, "claim requires a name to be given in the instantioator of the TextDisplay instance!\r\n");
@@ -75,3 +84,4 @@ bool TextDisplay::claim (FILE *stream) {
     setvbuf(stdout, NULL, _IOLBF, columns());
     return true;
 } 
+#endif
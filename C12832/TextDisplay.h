@@ -17,6 +17,7 @@
 #define MBED_TEXTDISPLAY_H
 
 #include "mbed.h"
+#include "C12832_config.h"
 
 class TextDisplay : public Stream {
 public:
@@ -48,10 +49,12 @@ public:
     
     // functions that come for free, but can be overwritten
 
+#if C12832_STDIO
     /** redirect output from a stream (stoud, sterr) to  display
     * @param stream stream that shall be redirected to the TextDisplay
     */
     virtual bool claim (FILE *stream);
+#endif
 
     /** clear screen
     */
@@ -74,7 +77,9 @@ protected:
     // colours
     uint16_t _foreground;
     uint16_t _background;
+#if C12832_STDIO
     char *_path;
+#endif
 };
 
 #endif
@@ -0,0 +1,117 @@
+/* text lines with change detection for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ */
+
+// 16.10.26    initial design
+
+#include "TextGrid.h"
+#include "stdarg.h"
+
+TextGrid::TextGrid(C12832& lcd, int rows, int cols, int line_height)
+    : _lcd(lcd), _rows(rows), _cols(cols), _line_height(line_height), _glyphs(0)
+{
+    _text = new char[rows * (cols + 1)];
+    _line = new char[cols + 1];
+    _valid = new unsigned char[rows];
+    memset(_text, 0, rows * (cols + 1));
+    invalidate();
+}
+
+TextGrid::~TextGrid()
+{
+    delete[] _text;
+    delete[] _line;
+    delete[] _valid;
+}
+
+void TextGrid::invalidate(void)
+{
+    memset(_valid, 0, _rows);
+}
+
+unsigned int TextGrid::get_glyphs_drawn(void)
+{
+    return _glyphs;
+}
+
+// clear the cell x .. x + w - 1 of a line and draw char c into it,
+// the clip keeps the char cell of the font from erasing the neighbours.
+// character() moves the cursor of the lcd, it is put back.
+
+void TextGrid::cell(int x, int y, int w, int c)
+{
+    int x0, y0, x1, y1;
+    int cx0, cy0, cx1, cy1;
+    int lx, ly;
+
+    _lcd.get_clip(x0, y0, x1, y1);
+    cx0 = (x > x0) ? x : x0;
+    cy0 = (y > y0) ? y : y0;
+    cx1 = (x + w - 1 < x1) ? x + w - 1 : x1;
+    cy1 = (y + _line_height - 1 < y1) ? y + _line_height - 1 : y1;
+    if(cx0 <= cx1 && cy0 <= cy1) {
+        _lcd.set_clip(cx0, cy0, cx1, cy1);
+        _lcd.fillrect(cx0, cy0, cx1, cy1, 0);
+        if(c) {
+            _lcd.get_locate(lx, ly);
+            _lcd.character(x, y, c);
+            _lcd.locate(lx, ly);
+            _glyphs++;
+        }
+        _lcd.set_clip(x0, y0, x1, y1);
+    }
+}
+
+// the chars of a line are placed one after the other, a char is drawn
+// if it changed or the chars in front of it changed their width
+
+void TextGrid::print(int row, const char* text)
+{
+    char* old;
+    unsigned int mode;
+    int i, n, x, xo, w, width;
+
+    if(row < 0 || row >= _rows) return;
+    old = &_text[row * (_cols + 1)];
+    n = strlen(old);
+    width = _lcd.width();
+    mode = _lcd.draw_mode;
+    _lcd.draw_mode = NORMAL;
+    _lcd.begin_frame();
+
+    x = 0;                            // position of char i in the new text
+    xo = 0;                           // and in the old text
+    for(i = 0; i < _cols && text[i]; i++) {
+        w = _lcd.char_width(text[i]);
+        if(!(_valid[row] && i < n && old[i] == text[i] && x == xo) && x < width) {
+            cell(x, row * _line_height, w, text[i]);
+        }
+        x += w;
+        if(i < n) xo += _lcd.char_width(old[i]);
+    }
+    if(i < n) {                       // rest of the longer old text
+        for(w = i; w < n; w++) xo += _lcd.char_width(old[w]);
+    }
+    memcpy(old, text, i);
+    old[i] = 0;
+
+    // clear behind the end of the text
+    if(!_valid[row]) xo = width;
+    if(xo > x && x < width) cell(x, row * _line_height, xo - x, 0);
+    _valid[row] = 1;
+
+    _lcd.end_frame();
+    _lcd.draw_mode = mode;
+}
+
+int TextGrid::printf(int row, const char* format, ...)
+{
+    va_list arg;
+    int n;
+
+    va_start(arg, format);
+    n = vsnprintf(_line, _cols + 1, format, arg);
+    va_end(arg);
+    print(row, _line);
+    return n;
+}
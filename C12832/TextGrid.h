@@ -0,0 +1,81 @@
+/* text lines with change detection for the mbed Lab Board 128*32 pixel LCD
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * TextGrid remembers the text of each line. A new text is compared
+ * with the old one char by char, only the chars that changed or moved
+ * are drawn again and a line that got shorter is cleared behind its end.
+ * No spaces are needed to erase old text.
+ *
+ * @code
+ * C12832 lcd(D11, D13, D12, D7, D10);
+ * TextGrid text(lcd);
+ *
+ * while(1) {
+ *     text.printf(0, "Current time:");
+ *     text.printf(1, "%02d:%02d:%02d", h, m, s);  // only the digits that tick are drawn
+ *     text.print(2, "");
+ * }
+ * @endcode
+ */
+
+#ifndef TEXTGRID_H
+#define TEXTGRID_H
+
+#include "C12832.h"
+
+class TextGrid
+{
+public:
+    /** Create a text grid on a C12832
+      *
+      * @param lcd display
+      * @param rows number of text lines
+      * @param cols chars per line, longer text is cut
+      * @param line_height pixel from one line to the next
+      */
+    TextGrid(C12832& lcd, int rows = 3, int cols = 32, int line_height = 10);
+
+    ~TextGrid();
+
+    /** set the text of a line
+      *
+      * @param row line 0 .. rows - 1
+      * @param text new text
+      */
+    void print(int row, const char* text);
+
+    /** set the text of a line, printf format
+      *
+      * @param row line 0 .. rows - 1
+      * @param format printf format string
+      * @returns number of characters of the text
+      */
+    int printf(int row, const char* format, ...);
+
+    /** forget the old text
+      *
+      * the next print of each line draws all chars and clears the
+      * rest of the line, call it after drawing over the text or cls()
+      */
+    void invalidate(void);
+
+    /** get the number of chars drawn
+      *
+      * @returns chars drawn since the grid was created
+      */
+    unsigned int get_glyphs_drawn(void);
+
+private:
+    void cell(int x, int y, int w, int c);
+
+    C12832& _lcd;
+    int _rows;
+    int _cols;
+    int _line_height;
+    char* _text;                 // rows * (cols + 1), text on the screen
+    char* _line;                 // cols + 1, printf buffer
+    unsigned char* _valid;       // 0 = text of the line not known
+    unsigned int _glyphs;
+};
+
+#endif
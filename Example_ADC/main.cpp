@@ -1,19 +1,38 @@
 #include "mbed.h"
 #include "C12832.h" // URL: http://os.mbed.com/users/askksa12543/code/C12832/
+#include "TextGrid.h"
+#include "StripChart.h"
+
+#define SAMPLE_RATE         500     // samples per second
+#define SAMPLES_PER_COLUMN  10      // 50 columns per second, 2.5 s on the chart
 
 C12832 lcd(D11, D13, D12, D7, D10);
 AnalogIn analog_source(A0);
+StripChart chart(lcd, 0, 10, 128, 22, SAMPLES_PER_COLUMN);
+Ticker sampler;
+
+volatile float adc_in;
+
+void sample() {
+    adc_in = analog_source.read();
+    chart.add(adc_in * 3300);       // unit: mV
+}
 
 int main() {
-    float adc_in;
+    TextGrid text(lcd, 1);
     float adc_voltage;
 
+    chart.set_range(0, 3300);
+    sampler.attach(&sample, 1.0f / SAMPLE_RATE);
+
     while(1) {
-        adc_in = analog_source.read();
         adc_voltage = adc_in * 3300; // unit: mV
 
-        lcd.locate(0, 0);
-        lcd.printf("adc_in: %f\nadc_voltage: %f mV", adc_in, adc_voltage);
+        {
+            C12832::Frame frame(lcd);   // one update for text and chart
+            text.printf(0, "adc_voltage: %4.0f mV", adc_voltage);
+            chart.draw();
+        }
         wait(0.1);
     }
 
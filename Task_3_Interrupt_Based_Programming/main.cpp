@@ -1,7 +1,9 @@
 #include "mbed.h"
 #include "C12832.h"
+#include "DrawQueue.h"
 
 C12832 lcd_screen(D11, D13, D12, D7, D10);
+DrawQueue lcd_queue(lcd_screen);   // the interrupts post here, main() draws
 Ticker lcd_ticker;
 
 class RGBLED {
@@ -69,45 +71,39 @@ class Equation {
         }
 }equation;
 
-void lcd_init() {
-    lcd_screen.cls();        //Clear the screen
-    lcd_screen.locate(20,0); //Locate at (20,0)
-    lcd_screen.printf("%.0lf %c %.0lf = %.2lf", equation.num_1, equation.sign_table(), equation.num_2, equation.ans);
-}
-
-void lcd_cursor_print() {
-    static bool flag_cursor = false;  // indicate if the flag is shown on the screen
-    if (flag_cursor == false) {    // the cursor is not currently appearing on the screen
-        flag_cursor = true;       // toggle the flag 
-        if (equation.current_num == 1) {        // cursor under the first number
-            lcd_screen.locate(20,8);
-            lcd_screen.printf("-");
-        } else if (equation.current_num == 2){ // cursor under the second number
-            lcd_screen.locate(40,8);
-            lcd_screen.printf("-");
-        } else {                               // cursor under the sign
-            lcd_screen.locate(30,8);
-            lcd_screen.printf("-");
-        }
-    } else {
-        flag_cursor = false;
-        lcd_screen.locate(20,10);
-        lcd_screen.printf("                         "); // print 25 spaces
+void lcd_cursor_move() {
+    // the cursor lives on the overlay layer, the equation underneath is not touched
+    lcd_queue.fill(20, 8, 50, 15, 0, LAYER_OVERLAY);   // remove the old cursor
+    if (equation.current_num == 1) {        // cursor under the first number
+        lcd_queue.text(20, 8, "-", LAYER_OVERLAY);
+    } else if (equation.current_num == 2){ // cursor under the second number
+        lcd_queue.text(40, 8, "-", LAYER_OVERLAY);
+    } else {                               // cursor under the sign
+        lcd_queue.text(30, 8, "-", LAYER_OVERLAY);
     }
 }
 
 void lcd_equation_print() {
-    lcd_screen.locate(20,0);
-    lcd_screen.printf("                              "); // print 30 spaces
+    lcd_queue.fill(20, 0, 127, 8, 0);     // clear the old equation
     if (equation.flag_NA == false) {
-        lcd_screen.locate(20,0); //Locate at (20,0)
-        lcd_screen.printf("%.0lf %c %.0lf = N/A", equation.num_1, equation.sign_table(), equation.num_2);
+        lcd_queue.printf(20, 0, "%.0lf %c %.0lf = N/A", equation.num_1, equation.sign_table(), equation.num_2);
     } else {
-        lcd_screen.locate(20,0); //Locate at (20,0)
-        lcd_screen.printf("%.0lf %c %.0lf = %.2lf", equation.num_1, equation.sign_table(), equation.num_2, equation.ans);
+        lcd_queue.printf(20, 0, "%.0lf %c %.0lf = %.2lf", equation.num_1, equation.sign_table(), equation.num_2, equation.ans);
     }
 }
 
+void lcd_init() {
+    lcd_screen.cls();        //Clear the screen
+    lcd_equation_print();
+    lcd_cursor_move();
+}
+
+void lcd_cursor_print() {
+    static bool flag_cursor = false;  // indicate if the flag is shown on the screen
+    flag_cursor = !flag_cursor;       // toggle the flag
+    lcd_queue.show(LAYER_OVERLAY, flag_cursor); // only the cursor columns are sent
+}
+
 void joystick_up_pressed() {
     if (equation.current_num == 1) {
         equation.num_1 = int(equation.num_1 + 1) % 10;
@@ -134,7 +130,7 @@ void joystick_down_pressed() {
 
 void joystick_fire_pressed() {
     equation.current_num = equation.current_num % 3 + 1;
-    lcd_cursor_print();
+    lcd_cursor_move();
     
     if (equation.current_num == 1)      rgb_led.red_on(); 
     else if (equation.current_num == 2) rgb_led.yellow_on();
@@ -157,6 +153,9 @@ int main() {
     joystick_down.rise(&joystick_down_pressed);
     joystick_fire.rise(&joystick_fire_pressed);
 
-    while(1) {}
+    while(1) {
+        lcd_queue.drain();   // all drawing of the interrupts in one frame
+        wait(0.02);
+    }
 
 }
@@ -1,5 +1,6 @@
 #include "mbed.h"
 #include "C12832.h"
+#include "TextGrid.h"
 #include <cstdint>
 
 // Macro definition
@@ -329,18 +330,14 @@ void joystick_fire_pressed() {
 
 // State machine functions
 
-void state_machine_init(C12832 *lcd_screen, Clock *system_clock) {
-    lcd_screen->locate(0, 0);
-    lcd_screen->printf("Press Fire to set time:          ");
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("%02d:%02d:%02d                    ", system_clock->get_hour(), system_clock->get_min(), system_clock->get_sec());
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("                    ");
+void state_machine_init(TextGrid *text, Clock *system_clock) {
+    text->printf(0, "Press Fire to set time:");
+    text->printf(1, "%02d:%02d:%02d", system_clock->get_hour(), system_clock->get_min(), system_clock->get_sec());
+    text->print(2, "");
 }
 
-void state_machine_set_time(C12832 *lcd_screen, SamplingPotentiometer *pot_left, SamplingPotentiometer *pot_right, Clock *system_clock) {
-    lcd_screen->locate(0, 0);
-    lcd_screen->printf("Set new time (HH:MM)          ");
+void state_machine_set_time(TextGrid *text, SamplingPotentiometer *pot_left, SamplingPotentiometer *pot_right, Clock *system_clock) {
+    text->printf(0, "Set new time (HH:MM)");
     int hour = int(pot_left->amplitudeNorm() * 24); 
     int min  = int(pot_right->amplitudeNorm() * 60);
     if (hour == 24) hour = 23;
@@ -349,22 +346,17 @@ void state_machine_set_time(C12832 *lcd_screen, SamplingPotentiometer *pot_left,
     // however, the normalised voltage will never reach VDD due to internal circuitry design 
     // so here it is modified to *24 or *60 to make sure the highest value reaches 23 or 59
     system_clock->set_clock(hour, min);
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("%02d:%02d          ", hour, min);
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("                    ");
+    text->printf(1, "%02d:%02d", hour, min);
+    text->print(2, "");
 }
 
-void state_machine_current_time(C12832 *lcd_screen, Clock *system_clock) {
-    lcd_screen->locate(0, 0);
-    lcd_screen->printf("Current time:          ");
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("%02d:%02d:%02d          ", system_clock->get_hour(), system_clock->get_min(), system_clock->get_sec());
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("                    ");
+void state_machine_current_time(TextGrid *text, Clock *system_clock) {
+    text->printf(0, "Current time:");
+    text->printf(1, "%02d:%02d:%02d", system_clock->get_hour(), system_clock->get_min(), system_clock->get_sec());
+    text->print(2, "");
 }
 
-void state_machine_world_time(C12832 *lcd_screen, SamplingPotentiometer *pot_left, Clock *system_clock) {
+void state_machine_world_time(TextGrid *text, SamplingPotentiometer *pot_left, Clock *system_clock) {
     int time_zone_index = int(pot_left->amplitudeNorm() * 21); // 0 <= time_zone_index <= 20
     int hour = system_clock->get_hour();
     int min  = system_clock->get_min();
@@ -373,143 +365,130 @@ void state_machine_world_time(C12832 *lcd_screen, SamplingPotentiometer *pot_lef
     int new_min  = system_clock->get_min();
     int new_sec  = system_clock->get_sec();
 
-    lcd_screen->locate(0, 0);
-
     switch (time_zone_index) {
         case 0: // GMT-11
             new_hour = (new_hour + 24 - 11) % 24;
-            lcd_screen->printf("Pago Pago (GMT-11)          ");
+            text->printf(0, "Pago Pago (GMT-11)");
             break;
         case 1: // GMT-10
             new_hour = (new_hour + 24 - 10) % 24;
-            lcd_screen->printf("Papeete (GMT-10)          ");
+            text->printf(0, "Papeete (GMT-10)");
             break;
         case 2: // GMT-9
             new_hour = (new_hour + 24 - 9) % 24;
-            lcd_screen->printf("Sitka (GMT-9)          ");
+            text->printf(0, "Sitka (GMT-9)");
             break;
         case 3: // GMT-8
             new_hour = (new_hour + 24 - 8) % 24;
-            lcd_screen->printf("Los Angeles (GMT-8)          ");
+            text->printf(0, "Los Angeles (GMT-8)");
             break;
         case 4: // GMT-7
             new_hour = (new_hour + 24 - 7) % 24;
-            lcd_screen->printf("El Paso (GMT-7)          ");
+            text->printf(0, "El Paso (GMT-7)");
             break;
         case 5: // GMT-6
             new_hour = (new_hour + 24 - 6) % 24;
-            lcd_screen->printf("San Salvador (GMT-6)          ");
+            text->printf(0, "San Salvador (GMT-6)");
             break;
         case 6: // GMT-5
             new_hour = (new_hour + 24 - 5) % 24;
-            lcd_screen->printf("Havana (GMT-5)          ");
+            text->printf(0, "Havana (GMT-5)");
             break;
         case 7: // GMT-4
             new_hour = (new_hour + 24 - 4) % 24;
-            lcd_screen->printf("Valencia (GMT-4)          ");
+            text->printf(0, "Valencia (GMT-4)");
             break;
         case 8: // GMT-3
             new_hour = (new_hour + 24 - 3) % 24;
-            lcd_screen->printf("Buenos Aires (GMT-3)          ");
+            text->printf(0, "Buenos Aires (GMT-3)");
             break;
         case 9: // GMT-2
             new_hour = (new_hour + 24 - 2) % 24;
-            lcd_screen->printf("Grytviken (GMT-2)          ");
+            text->printf(0, "Grytviken (GMT-2)");
             break;
         case 10: // GMT-1
             new_hour = (new_hour + 24 - 1) % 24;
-            lcd_screen->printf("Praia (GMT-1)          ");
+            text->printf(0, "Praia (GMT-1)");
             break;
         case 11: // GMT+0
-            lcd_screen->printf("London (GMT+0)          ");
+            text->printf(0, "London (GMT+0)");
             break;
         case 12: // GMT+1
             new_hour = (new_hour + 1) % 24;
-            lcd_screen->printf("Melilla (GMT+1)          ");
+            text->printf(0, "Melilla (GMT+1)");
             break;
         case 13: // GMT+2
             new_hour = (new_hour + 2) % 24;
-            lcd_screen->printf("Juba (GMT+2)          ");
+            text->printf(0, "Juba (GMT+2)");
             break;
         case 14: // GMT+3
             new_hour = (new_hour + 3) % 24;
-            lcd_screen->printf("Amman (GMT+3)          ");
+            text->printf(0, "Amman (GMT+3)");
             break;
         case 15: // GMT+3:30
             new_hour = (new_hour + (new_min + 30) / 60 + 3) % 24;
             new_min = (new_min + 30) % 60;
-            lcd_screen->printf("Tehran (GMT+3:30)          ");
+            text->printf(0, "Tehran (GMT+3:30)");
             break;
         case 16: // GMT+4
             new_hour = (new_hour + 4) % 24;
-            lcd_screen->printf("Dubai (GMT+4)          ");
+            text->printf(0, "Dubai (GMT+4)");
             break;
         case 17: // GMT+8
             new_hour = (new_hour + 8) % 24;
-            lcd_screen->printf("Shanghai (GMT+8)          ");
+            text->printf(0, "Shanghai (GMT+8)");
             break;
         case 18: // GMT+10
             new_hour = (new_hour + 10) % 24;
-            lcd_screen->printf("Sydney (GMT+10)          ");
+            text->printf(0, "Sydney (GMT+10)");
             break;
         case 19: // GMT+11
             new_hour = (new_hour + 11) % 24;
-            lcd_screen->printf("Tofol (GMT+11)          ");
+            text->printf(0, "Tofol (GMT+11)");
             break;
         case 20: // GMT+12
             new_hour = (new_hour + 12) % 24;
-            lcd_screen->printf("Auckland (GMT+12)          ");
+            text->printf(0, "Auckland (GMT+12)");
             break;
         default:
             new_hour = (new_hour + 12) % 24;
-            lcd_screen->printf("Auckland (GMT+12)          ");
+            text->printf(0, "Auckland (GMT+12)");
     }
 
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("%02d:%02d:%02d          ", new_hour, new_min, new_sec);
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("%02d:%02d:%02d  (Manchester)", hour, min, sec);
+    text->printf(1, "%02d:%02d:%02d", new_hour, new_min, new_sec);
+    text->printf(2, "%02d:%02d:%02d  (Manchester)", hour, min, sec);
 }
 
-void state_machine_stopwatch_inactive(C12832 *lcd_screen, Stopwatch *stopwatch) {
+void state_machine_stopwatch_inactive(TextGrid *text, Stopwatch *stopwatch) {
     if (stopwatch->get_stopwatch_status() == true) {
         stopwatch->led_off();
         stopwatch->stopwatch_stop();
     }
 
-    lcd_screen->locate(0, 0);
-    lcd_screen->printf("Stopwatch: inactive          ");
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("Last time: %.2f s          ", stopwatch->stopwatch_read());
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("                    ");
+    text->printf(0, "Stopwatch: inactive");
+    text->printf(1, "Last time: %.2f s", stopwatch->stopwatch_read());
+    text->print(2, "");
 }
 
-void state_machine_stopwatch_active(C12832 *lcd_screen, Stopwatch *stopwatch) {
+void state_machine_stopwatch_active(TextGrid *text, Stopwatch *stopwatch) {
     if (stopwatch->get_stopwatch_status() == false) {
         stopwatch->stopwatch_reset();
         stopwatch->stopwatch_start();
         stopwatch->led_on();
     }
 
-    lcd_screen->locate(0, 0);
-    lcd_screen->printf("Stopwatch: running          ");
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("Time: %.2f s          ", stopwatch->stopwatch_read());
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("                    ");
+    text->printf(0, "Stopwatch: running");
+    text->printf(1, "Time: %.2f s", stopwatch->stopwatch_read());
+    text->print(2, "");
 }
 
-void state_machine_countdown_timer_elapsed(C12832 *lcd_screen) {
-    lcd_screen->locate(0, 0);
-    lcd_screen->printf("Time period elapsed!          ");
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("                    ");
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("                    ");
+void state_machine_countdown_timer_elapsed(TextGrid *text) {
+    text->printf(0, "Time period elapsed!");
+    text->print(1, "");
+    text->print(2, "");
 }
 
-void state_machine_countdown_timer_inactive(C12832 *lcd_screen, SamplingPotentiometer *pot_left, SamplingPotentiometer *pot_right, Countdown_Timer *countdown_timer) {
+void state_machine_countdown_timer_inactive(TextGrid *text, SamplingPotentiometer *pot_left, SamplingPotentiometer *pot_right, Countdown_Timer *countdown_timer) {
     if (countdown_timer->get_countdown_timer_status() == true) {
         countdown_timer->timer_stop();
     }
@@ -520,29 +499,23 @@ void state_machine_countdown_timer_inactive(C12832 *lcd_screen, SamplingPotentio
     if (sec == 60) sec = 59;
     countdown_timer->set_countdown_period(float(min*60+sec));
 
-    lcd_screen->locate(0, 0);
-    lcd_screen->printf("Set countdown period:          ");
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("%02d:%02d               ", min, sec);
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("                    ");
+    text->printf(0, "Set countdown period:");
+    text->printf(1, "%02d:%02d", min, sec);
+    text->print(2, "");
 }
 
-void state_machine_countdown_timer_active(C12832 *lcd_screen, SamplingPotentiometer *pot_left, SamplingPotentiometer *pot_right, Countdown_Timer *countdown_timer) {
+void state_machine_countdown_timer_active(TextGrid *text, SamplingPotentiometer *, SamplingPotentiometer *, Countdown_Timer *countdown_timer) {
     if (countdown_timer->get_countdown_timer_status() == false) {
         countdown_timer->timer_start();
     } 
     if (countdown_timer->get_countdown_timer_elapsed_status() == true) {
         e_program_state = e_countdown_timer_elapsed;
-        state_machine_countdown_timer_elapsed(lcd_screen);
+        state_machine_countdown_timer_elapsed(text);
     }
 
-    lcd_screen->locate(0, 0);
-    lcd_screen->printf("Countdown timer running:          ");
-    lcd_screen->locate(0, 10);
-    lcd_screen->printf("%d / %d s               ", int(countdown_timer->get_current_time()), int(countdown_timer->get_countdown_period()));
-    lcd_screen->locate(0, 20);
-    lcd_screen->printf("                    ");
+    text->printf(0, "Countdown timer running:");
+    text->printf(1, "%d / %d s", int(countdown_timer->get_current_time()), int(countdown_timer->get_countdown_period()));
+    text->print(2, "");
 }
 
 int main() {
@@ -550,6 +523,8 @@ int main() {
     // Variable definition
 
     C12832 *lcd_screen = new C12832(D11, D13, D12, D7, D10);
+    lcd_screen->set_auto_up(0); // the screen is updated once per loop by DMA
+    TextGrid *text = new TextGrid(*lcd_screen); // only the chars that changed are drawn
     Clock *system_clock = new Clock;
     SamplingPotentiometer *pot_left  = new SamplingPotentiometer(A0, 3.3f, POT_SAMPLING_FREQ);
     SamplingPotentiometer *pot_right = new SamplingPotentiometer(A1, 3.3f, POT_SAMPLING_FREQ);
@@ -573,19 +548,19 @@ int main() {
         switch (e_program_state) {
 
             case (e_init):
-                state_machine_init(lcd_screen, system_clock);
+                state_machine_init(text, system_clock);
                 break;
 
             case (e_set_time):
-                state_machine_set_time(lcd_screen, pot_left, pot_right, system_clock);
+                state_machine_set_time(text, pot_left, pot_right, system_clock);
                 break;
 
             case (e_current_time):
-                state_machine_current_time(lcd_screen, system_clock);
+                state_machine_current_time(text, system_clock);
                 break;
 
             case (e_world_time):
-                state_machine_world_time(lcd_screen, pot_left, system_clock);
+                state_machine_world_time(text, pot_left, system_clock);
                 break;
 
             case (e_stopwatch):
@@ -594,35 +569,38 @@ int main() {
                 else e_program_state = e_stopwatch_inactive;
                 break;
             case (e_stopwatch_inactive):
-                state_machine_stopwatch_inactive(lcd_screen, stopwatch);
+                state_machine_stopwatch_inactive(text, stopwatch);
                 break;
             case (e_stopwatch_active):
-                state_machine_stopwatch_active(lcd_screen, stopwatch);
+                state_machine_stopwatch_active(text, stopwatch);
                 break;
 
             case (e_countdown_timer):
                 if (countdown_timer->get_countdown_timer_status() == true) {
                     e_program_state = e_countdown_timer_active;
-                    state_machine_countdown_timer_active(lcd_screen, pot_left, pot_right, countdown_timer);
+                    state_machine_countdown_timer_active(text, pot_left, pot_right, countdown_timer);
                 } else {
                     e_program_state = e_countdown_timer_inactive;
-                    state_machine_countdown_timer_inactive(lcd_screen, pot_left, pot_right, countdown_timer);
+                    state_machine_countdown_timer_inactive(text, pot_left, pot_right, countdown_timer);
                 }
                 break;
             case (e_countdown_timer_inactive):
-                state_machine_countdown_timer_inactive(lcd_screen, pot_left, pot_right, countdown_timer);
+                state_machine_countdown_timer_inactive(text, pot_left, pot_right, countdown_timer);
                 break;
             case (e_countdown_timer_active):
-                state_machine_countdown_timer_active(lcd_screen, pot_left, pot_right, countdown_timer);
+                state_machine_countdown_timer_active(text, pot_left, pot_right, countdown_timer);
                 break;
             case (e_countdown_timer_elapsed):
-                state_machine_countdown_timer_elapsed(lcd_screen);
+                state_machine_countdown_timer_elapsed(text);
                 break;
 
             default:
-                state_machine_init(lcd_screen, system_clock);
+                state_machine_init(text, system_clock);
         }
 
+        // send the changes of this loop, the next loop runs while the DMA is busy
+        lcd_screen->flush_async();
+
     }
 
 }
@@ -0,0 +1,375 @@
+/* fontconv - font converter for the C12832 library
+ * Released under the MIT License: http://mbed.org/license/mit
+ *
+ * Reads a font array out of a C source file and writes a header with
+ * the font in the page layout of the LCD (see C12832/PageFont.h).
+ *
+ * build :  g++ -O2 -o fontconv fontconv.cpp
+ *
+ * usage :  fontconv [-s|-z] -g <file> <array> <name>   GLCD Font Creator font
+ *          fontconv [-s|-z] -r <file> <array> <name>   8x8 font, one byte per row
+ *          fontconv -b <file> <array> <name> <w> <h>   bitmap, bit 7 = left pixel
+ *
+ *   -s   add the 8 shifted variants, chars are drawn at any row
+ *        without moving bits at runtime (8 times the glyph data)
+ *   -z   packed font, each glyph cut to its used columns and rows
+ *        and stored bit by bit, decoded when drawn (cell up to 15x16)
+ *   -b   packed bitmap, page layout with run length coding (see Blit.h)
+ *
+ * The header goes to stdout, the size of the input and the output
+ * font goes to stderr. The fonts of the library are made with :
+ *
+ *   fontconv -s -g C12832/Small_7.h Small_7 Small_7_page > C12832/Small_7_page.h
+ *   fontconv -r C12832/GraphicsDisplay.cpp FONT8x8 Font8x8_page > C12832/Font8x8_page.h
+ *   fontconv -z -g C12832/Small_7.h Small_7 Small_7_packed > C12832/Small_7_packed.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct Font {
+    int first;                       // first char
+    int height;                      // height in pixel
+    int width;                       // width of the char cell
+    std::vector<int> advance;        // advance per char
+    std::vector<uint32_t> columns;   // width columns per char, bit 0 = top row
+};
+
+static void fail(const char* msg, const char* arg)
+{
+    fprintf(stderr, "fontconv: %s %s\n", msg, arg);
+    exit(1);
+}
+
+// read the numbers of the initializer of an array
+
+static std::vector<int> read_array(const char* file, const char* array)
+{
+    std::vector<int> v;
+    std::string text;
+    char buf[4096];
+    size_t n;
+    FILE* f = fopen(file, "rb");
+    if(f == NULL) fail("can not open", file);
+    while((n = fread(buf, 1, sizeof(buf), f)) > 0) text.append(buf, n);
+    fclose(f);
+
+    // find "<array>[" as a whole word
+    size_t pos = 0;
+    for(;;) {
+        pos = text.find(array, pos);
+        if(pos == std::string::npos) fail("array not found:", array);
+        size_t end = pos + strlen(array);
+        bool word = (pos == 0 || !(isalnum((unsigned char)text[pos - 1]) || text[pos - 1] == '_'));
+        while(end < text.size() && isspace((unsigned char)text[end])) end++;
+        if(word && end < text.size() && text[end] == '[') {
+            pos = end;
+            break;
+        }
+        pos++;
+    }
+    pos = text.find('{', pos);
+    if(pos == std::string::npos) fail("no initializer for", array);
+    pos++;
+
+    const char* p = text.c_str() + pos;
+    while(*p && *p != '}') {
+        if(p[0] == '/' && p[1] == '/') {            // line comment
+            while(*p && *p != '\n') p++;
+        } else if(p[0] == '/' && p[1] == '*') {     // block comment
+            p += 2;
+            while(*p && !(p[0] == '*' && p[1] == '/')) p++;
+            if(*p) p += 2;
+        } else if(isdigit((unsigned char)*p)) {
+            char* e;
+            v.push_back((int)strtol(p, &e, 0));
+            p = e;
+        } else {
+            p++;
+        }
+    }
+    return v;
+}
+
+// GLCD Font Creator : bytes / char, hor, vert, bytes / column,
+// then per char the advance and hor columns of bytes / column bytes
+
+static Font read_glcd(const std::vector<int>& v)
+{
+    Font font;
+    if(v.size() < 4) fail("font header missing", "");
+    int offset = v[0];
+    int hor = v[1];
+    int vert = v[2];
+    int bpl = v[3];
+    if(vert > 32 || bpl > 4) fail("font higher than 32 pixel", "");
+    int chars = (int)(v.size() - 4) / offset;
+
+    font.first = 32;
+    font.height = vert;
+    font.width = hor;
+    for(int c = 0; c < chars; c++) {
+        const int* z = &v[4 + c * offset];
+        font.advance.push_back(z[0]);
+        for(int i = 0; i < hor; i++) {
+            uint32_t col = 0;
+            for(int j = 0; j < bpl; j++) col |= (uint32_t)(z[1 + bpl * i + j] & 0xFF) << (8 * j);
+            if(vert < 32) col &= (1UL << vert) - 1;
+            font.columns.push_back(col);
+        }
+    }
+    return font;
+}
+
+// 8x8 row font : first row holds columns, rows, bytes / char,
+// then 8 rows per char starting at 0x20, bit 7 = left pixel
+
+static Font read_rows8(const std::vector<int>& v)
+{
+    Font font;
+    if(v.size() < 8) fail("font header missing", "");
+    int chars = (int)(v.size() - 8) / 8;
+
+    font.first = 0x20;
+    font.height = 8;
+    font.width = 8;
+    for(int c = 0; c < chars; c++) {
+        const int* z = &v[8 + c * 8];
+        font.advance.push_back(v[0]);
+        for(int i = 0; i < 8; i++) {              // transpose 8x8
+            uint32_t col = 0;
+            for(int r = 0; r < 8; r++) {
+                if(z[r] & (0x80 >> i)) col |= 1UL << r;
+            }
+            font.columns.push_back(col);
+        }
+    }
+    return font;
+}
+
+static void write_font(const Font& font, const char* name, int variants, const char* source, size_t source_size)
+{
+    int chars = (int)font.advance.size();
+    int stride = (font.height + 7 + (variants == 8 ? 7 : 0)) / 8;
+    int last = font.first + chars - 1;
+    size_t size = 8 + chars + (size_t)variants * chars * font.width * stride;
+    std::string guard(name);
+    for(size_t i = 0; i < guard.size(); i++) guard[i] = tolower((unsigned char)guard[i]);
+
+    printf("// generated by tools/fontconv from %s, do not edit\n", source);
+    printf("// page font, see PageFont.h\n\n");
+    printf("#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+    printf("const unsigned char %s[] = {\n", name);
+    printf("        0x00, 'P', %d, %d, %d, %d, %d, %d,%*s// magic, first, last, height, width, bytes/column, variants\n",
+           font.first, last, font.height, font.width, stride, variants, 8, "");
+    printf("        // advance\n");
+    for(int c = 0; c < chars; c++) {
+        printf("%s%d,", (c % 16) == 0 ? "        " : " ", font.advance[c]);
+        if((c % 16) == 15 || c == chars - 1) printf("\n");
+    }
+    for(int s = 0; s < variants; s++) {
+        if(variants > 1) printf("        // variant %d\n", s);
+        for(int c = 0; c < chars; c++) {
+            printf("       ");
+            for(int i = 0; i < font.width; i++) {
+                uint64_t col = (uint64_t)font.columns[c * font.width + i] << s;
+                for(int j = 0; j < stride; j++) {
+                    bool end = (s == variants - 1 && c == chars - 1 && i == font.width - 1 && j == stride - 1);
+                    printf(" 0x%02X%s", (unsigned int)((col >> (8 * j)) & 0xFF), end ? " " : ",");
+                }
+            }
+            int ch = font.first + c;
+            if(ch == '\\') printf("  // Code for char \\ (back slash)\n");   // no line splice
+            else printf("  // Code for char %c\n", (ch > 32 && ch < 127) ? ch : ' ');
+        }
+    }
+    printf("        };\n\n#endif\n");
+
+    fprintf(stderr, "%s: %d chars %dx%d, %d variant(s), %u bytes (source %u bytes)\n",
+            name, chars, font.width, font.height, variants, (unsigned int)size, (unsigned int)source_size);
+}
+
+// packed glyph : lead << 4 | columns, then if columns > 0
+// top << 4 | (rows - 1) and columns * rows bits, bit 0 of a byte first
+
+static std::vector<int> pack_glyph(const Font& font, int c)
+{
+    std::vector<int> g;
+    const uint32_t* col = &font.columns[c * font.width];
+    uint32_t used = 0;
+    int lead, last, top, rows, i, r, n;
+
+    for(lead = 0; lead < font.width && col[lead] == 0; lead++);
+    if(lead == font.width) {                 // empty glyph
+        g.push_back(0);
+        return g;
+    }
+    for(last = font.width - 1; col[last] == 0; last--);
+    for(i = lead; i <= last; i++) used |= col[i];
+    for(top = 0; !(used & (1UL << top)); top++);
+    for(rows = 32 - top; !(used & (1UL << (top + rows - 1))); rows--);
+
+    g.push_back((lead << 4) | (last - lead + 1));
+    g.push_back((top << 4) | (rows - 1));
+    n = 0;
+    for(i = lead; i <= last; i++) {
+        for(r = 0; r < rows; r++, n++) {
+            if((n & 7) == 0) g.push_back(0);
+            if(col[i] & (1UL << (top + r))) g.back() |= 1 << (n & 7);
+        }
+    }
+    return g;
+}
+
+static void write_packed(const Font& font, const char* name, const char* source, size_t source_size)
+{
+    int chars = (int)font.advance.size();
+    int stride = (font.height + 7) / 8;
+    int last = font.first + chars - 1;
+    std::vector<std::vector<int> > glyphs;
+    std::vector<int> offset;
+    size_t size, data = 0;
+    std::string guard(name);
+    for(size_t i = 0; i < guard.size(); i++) guard[i] = tolower((unsigned char)guard[i]);
+
+    if(font.width > 15 || font.height > 16) fail("packed font cell larger than 15x16", "");
+    for(int c = 0; c < chars; c++) {
+        glyphs.push_back(pack_glyph(font, c));
+        offset.push_back((int)data);
+        data += glyphs.back().size();
+    }
+    if(data > 0xFFFF) fail("packed font larger than 64k", "");
+    int index = (chars + 15) / 16;
+    size = 8 + chars + 2 * index + data;
+
+    printf("// generated by tools/fontconv from %s, do not edit\n", source);
+    printf("// packed font, see PageFont.h\n\n");
+    printf("#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+    printf("const unsigned char %s[] = {\n", name);
+    printf("        0x00, 'Z', %d, %d, %d, %d, %d, 1,%*s// magic, first, last, height, width, bytes/column, variants\n",
+           font.first, last, font.height, font.width, stride, 8, "");
+    printf("        // advance\n");
+    for(int c = 0; c < chars; c++) {
+        printf("%s%d,", (c % 16) == 0 ? "        " : " ", font.advance[c]);
+        if((c % 16) == 15 || c == chars - 1) printf("\n");
+    }
+    printf("        // offset of every 16th glyph\n");
+    for(int k = 0; k < index; k++) {
+        printf("%s0x%02X, 0x%02X,", (k % 8) == 0 ? "        " : " ", offset[16 * k] & 0xFF, offset[16 * k] >> 8);
+        if((k % 8) == 7 || k == index - 1) printf("\n");
+    }
+    for(int c = 0; c < chars; c++) {
+        printf("       ");
+        for(size_t i = 0; i < glyphs[c].size(); i++) {
+            bool end = (c == chars - 1 && i == glyphs[c].size() - 1);
+            printf(" 0x%02X%s", glyphs[c][i], end ? " " : ",");
+        }
+        int ch = font.first + c;
+        if(ch == '\\') printf("  // Code for char \\ (back slash)\n");
+        else printf("  // Code for char %c\n", (ch > 32 && ch < 127) ? ch : ' ');
+    }
+    printf("        };\n\n#endif\n");
+
+    fprintf(stderr, "%s: %d chars %dx%d, packed, %u bytes (source %u bytes)\n",
+            name, chars, font.width, font.height, (unsigned int)size, (unsigned int)source_size);
+}
+
+// packed bitmap : the pages of the bitmap one after the other, each
+// run is a count byte n and
+//   n < 128    n + 1 bytes copied
+//   n >= 128   the next byte n - 126 times
+
+static void write_bitmap(const std::vector<int>& v, const char* name, int w, int h, const char* source)
+{
+    int bil = (w + 7) / 8;
+    int pages = (h + 7) / 8;
+    std::vector<int> page, out;
+    std::string guard(name);
+    for(size_t i = 0; i < guard.size(); i++) guard[i] = tolower((unsigned char)guard[i]);
+
+    if(w > 128 || w < 1 || h < 1) fail("bitmap wider than 128 pixel", "");
+    if((int)v.size() < bil * h) fail("bitmap data too short for", name);
+    for(int p = 0; p < pages; p++) {
+        page.assign(w, 0);
+        for(int x = 0; x < w; x++) {
+            for(int r = 0; r < 8 && 8 * p + r < h; r++) {
+                if(v[(8 * p + r) * bil + x / 8] & (0x80 >> (x & 7))) page[x] |= 1 << r;
+            }
+        }
+        int i = 0;
+        while(i < w) {
+            int n = 1;
+            while(i + n < w && n < 129 && page[i + n] == page[i]) n++;
+            if(n >= 2) {                     // run
+                out.push_back(n + 126);
+                out.push_back(page[i]);
+                i += n;
+                continue;
+            }
+            n = 1;                           // literals up to the next run
+            while(i + n < w && n < 128 && !(i + n + 1 < w && page[i + n] == page[i + n + 1])) n++;
+            out.push_back(n - 1);
+            for(int k = 0; k < n; k++) out.push_back(page[i + k]);
+            i += n;
+        }
+    }
+
+    printf("// generated by tools/fontconv from %s, do not edit\n", source);
+    printf("// packed bitmap, see Blit.h\n\n");
+    printf("#ifndef %s\n#define %s\n\n#include \"Blit.h\"\n\n", guard.c_str(), guard.c_str());
+    printf("const unsigned char %s_data[] = {\n", name);
+    for(size_t i = 0; i < out.size(); i++) {
+        printf("%s0x%02X%s", (i % 16) == 0 ? "        " : " ", out[i], i == out.size() - 1 ? "" : ",");
+        if((i % 16) == 15 || i == out.size() - 1) printf("\n");
+    }
+    printf("        };\n\n");
+    printf("const PackedBitmap %s = {%d, %d, %s_data};\n\n#endif\n", name, w, h, name);
+
+    fprintf(stderr, "%s: %dx%d, packed, %u bytes (rows %u bytes)\n",
+            name, w, h, (unsigned int)out.size(), (unsigned int)(bil * h));
+}
+
+int main(int argc, char** argv)
+{
+    int variants = 1;
+    int packed = 0;
+    int arg = 1;
+    if(arg < argc && strcmp(argv[arg], "-s") == 0) {
+        variants = 8;
+        arg++;
+    } else if(arg < argc && strcmp(argv[arg], "-z") == 0) {
+        packed = 1;
+        arg++;
+    }
+    if(argc - arg == 6 && strcmp(argv[arg], "-b") == 0) {
+        const char* file = argv[arg + 1];
+        const char* base = strrchr(file, '/');
+        write_bitmap(read_array(file, argv[arg + 2]), argv[arg + 3], atoi(argv[arg + 4]), atoi(argv[arg + 5]), base ? base + 1 : file);
+        return 0;
+    }
+    if(argc - arg != 4) {
+        fprintf(stderr, "usage: fontconv [-s|-z] -g|-r <file> <array> <name>\n");
+        fprintf(stderr, "       fontconv -b <file> <array> <name> <w> <h>\n");
+        return 1;
+    }
+    const char* type = argv[arg];
+    const char* file = argv[arg + 1];
+    const char* array = argv[arg + 2];
+    const char* name = argv[arg + 3];
+
+    std::vector<int> v = read_array(file, array);
+    Font font;
+    if(strcmp(type, "-g") == 0) font = read_glcd(v);
+    else if(strcmp(type, "-r") == 0) font = read_rows8(v);
+    else fail("unknown font type", type);
+
+    const char* base = strrchr(file, '/');
+    if(packed) write_packed(font, name, base ? base + 1 : file, v.size());
+    else write_font(font, name, variants, base ? base + 1 : file, v.size());
+    return 0;
+}
@@ -0,0 +1,14 @@
+/* host fake of the pins of the STM32F4 peripherals, for the tests in tools/host
+ *
+ * D11 is the MOSI of SPI1 like on the NUCLEO_F401RE, D4 of SPI3.
+ * A panel on other pins has no DMA.
+ */
+
+#ifndef HOST_PERIPHERALPINS_H
+#define HOST_PERIPHERALPINS_H
+
+#include "pinmap.h"
+
+extern const PinMap PinMap_SPI_MOSI[];
+
+#endif
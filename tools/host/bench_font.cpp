@@ -0,0 +1,118 @@
+/* packed and page fonts against Small_7
+ *
+ * Small_7_page and Small_7_packed are made from Small_7 by fontconv and
+ * have to draw the same pixels. Three panels get the same random text,
+ * one per font, in NORMAL and XOR mode, the frame buffers are compared
+ * after every char.
+ *
+ * Then the flash of the three fonts and the glyphs per second : the
+ * digits of a clock, drawn again and again (the packed glyphs come from
+ * the cache), and all 96 chars in turn (every packed glyph is decoded).
+ * The numbers are from the host, only the ratio says something.
+ *
+ * usage : bench_font [chars]
+ */
+
+#include "mbed.h"
+#include "C12832.h"
+#include "Small_7.h"
+#include "Small_7_page.h"
+#include "Small_7_packed.h"
+
+#if !C12832_PACKED_FONTS
+#error bench_font needs C12832_PACKED_FONTS
+#endif
+
+class LcdFrame : public C12832
+{
+public:
+    LcdFrame(PinName mosi, PinName sck, PinName reset, PinName a0, PinName ncs)
+        : C12832(mosi, sck, reset, a0, ncs) {}
+
+    void frame_bytes(unsigned char* out)
+    {
+        int k;
+
+        for(k = 0; k < 4; k++) {
+            memcpy(out + k * 128, ram_data(k, 0, 0, 128), 128);
+        }
+    }
+};
+
+static const char* font_name[3] = {"Small_7", "Small_7_page", "Small_7_packed"};
+static const unsigned char* font_data[3] = {Small_7, Small_7_page, Small_7_packed};
+static const unsigned int font_size[3] = {sizeof(Small_7), sizeof(Small_7_page), sizeof(Small_7_packed)};
+
+// glyphs per second of a text drawn over and over at the same place
+static float glyph_rate(LcdFrame* lcd, const char* text, int chars)
+{
+    int i, k, n = strlen(text);
+    Timer t;
+
+    t.start();
+    for(i = 0; i < chars; i++) {
+        k = (i % n) * 6;              // 20 chars per line, 4 lines
+        lcd->character(k % 120, (k / 120 % 4) * 8, text[i % n]);
+    }
+    return chars / t.read();
+}
+
+int main(int argc, char** argv)
+{
+    static const char clock_text[] = "12:34:56";
+    char all_text[97];
+    unsigned char frame[3][512];
+    int chars = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int f, i, x, y, c, bad = 0, checked = 0;
+    unsigned int decodes;
+    float rate;
+    LcdFrame* lcd[3];
+
+    lcd[0] = new LcdFrame(D11, D13, D12, D7, D10);
+    lcd[1] = new LcdFrame(D2, D3, D5, D6, D8);
+    lcd[2] = new LcdFrame(D4, D9, D14, D15, A0);
+    for(f = 0; f < 3; f++) {
+#if C12832_AUTO_UP
+        lcd[f]->set_auto_up(0);
+#endif
+        lcd[f]->set_font((unsigned char*)font_data[f]);
+    }
+
+    srand(1);
+    for(i = 0; i < 20000; i++) {
+        x = rand() % 144 - 8;
+        y = rand() % 40 - 8;
+        c = 32 + rand() % 96;
+        for(f = 0; f < 3; f++) {
+            if(i % 64 == 0) lcd[f]->setmode((i / 64) & 1 ? XOR : NORMAL);
+            lcd[f]->character(x, y, c);
+            lcd[f]->frame_bytes(frame[f]);
+        }
+        checked++;
+        for(f = 1; f < 3; f++) {
+            if(memcmp(frame[0], frame[f], 512) != 0) {
+                if(bad < 5) printf("%s, char %d at %d,%d : frame differs from Small_7\n", font_name[f], c, x, y);
+                bad++;
+                lcd[f]->cls();
+            }
+        }
+        if(memcmp(frame[0], frame[1], 512) != 0 || memcmp(frame[0], frame[2], 512) != 0) lcd[0]->cls();
+    }
+    printf("bench_font : %d chars equal in all fonts, bad %d\n", checked, bad);
+
+    for(i = 0; i < 96; i++) all_text[i] = 32 + i;
+    all_text[96] = 0;
+    printf("  %-15s %6s %12s %12s\n", "font", "bytes", "clock/s", "all chars/s");
+    for(f = 0; f < 3; f++) {
+        lcd[f]->setmode(NORMAL);
+        printf("  %-15s %6u", font_name[f], font_size[f]);
+        decodes = lcd[f]->get_glyph_decodes();
+        rate = glyph_rate(lcd[f], clock_text, chars);
+        printf(" %11.2fM", rate / 1e6);
+        if(f == 2) decodes = lcd[f]->get_glyph_decodes() - decodes;
+        rate = glyph_rate(lcd[f], all_text, chars);
+        printf(" %11.2fM\n", rate / 1e6);
+    }
+    printf("  Small_7_packed decoded %u glyphs for %d clock digits\n", decodes, chars);
+    return bad != 0;
+}
@@ -0,0 +1,165 @@
+/* SPI traffic of the GrayScale refresher against full updates
+ *
+ * GrayScale shows its two planes in turn, each frame sends only the
+ * drawn columns and the columns where the planes differ. Three screens
+ * are run for some cycles :
+ *   bands  four bands of the 4 levels, nothing drawn after the start
+ *   gauge  a bar of 128 x 8 pixel in mid gray, drawn again every frame
+ *   gray   the whole screen in mid gray
+ * After each frame the frame buffer has to hold the plane of the frame.
+ *
+ * For comparison a full frame by copy_to_lcd() and by the old update
+ * with one CS cycle per byte (see bench_spi). Counted are the bytes and
+ * CS cycles per frame; the frames per second are what the bytes allow
+ * on a 20 MHz SPI, without the time between the bytes and CS cycles.
+ * The first cycle sends the whole screen and is left out.
+ *
+ * Build without TARGET_STM32F4, see run.sh.
+ *
+ * usage : bench_gray [cycles]
+ */
+
+#include "mbed.h"
+#include "C12832.h"
+#include "GrayScale.h"
+
+#define SPI_BYTES  (20e6 / 8)    // bytes per second at 20 MHz
+
+// the update as it was : one CS cycle per byte
+class LcdPerByte : public C12832
+{
+public:
+    LcdPerByte(PinName mosi, PinName sck, PinName reset, PinName a0, PinName ncs)
+        : C12832(mosi, sck, reset, a0, ncs) {}
+
+    void copy_per_byte(void)
+    {
+        const unsigned char* data;
+        int page, i;
+
+        _dev->lock();
+        for(page = 0; page < 4; page++) {
+            wr_cmd(0x00);             // set column low nibble 0
+            wr_cmd(0x10);             // set column hi  nibble 0
+            wr_cmd(0xB0 | page);      // set page address
+            data = ram_data(page, 0, 0, 128);
+            for(i = 0; i < 128; i++) {
+                wr_dat(data[i]);
+            }
+        }
+        _dev->unlock();
+    }
+
+    void frame_bytes(unsigned char* out)
+    {
+        int k;
+
+        for(k = 0; k < 4; k++) {
+            memcpy(out + k * 128, ram_data(k, 0, 0, 128), 128);
+        }
+    }
+};
+
+// the ticker fired by hand, the plane on the screen
+class GrayBench : public GrayScale
+{
+public:
+    GrayBench(C12832& lcd) : GrayScale(lcd) {}
+
+    void tick(void)
+    {
+        _ticker.fire();
+    }
+
+    int shown(void)
+    {
+        return _shown;
+    }
+};
+
+static void line(const char* name, unsigned long bytes, unsigned long cs, int frames)
+{
+    double b = (double)bytes / frames;
+
+    printf("  %-13s %7.1f %9.1f %9.0f\n", name, b, (double)cs / frames, b > 0 ? SPI_BYTES / b : 0.0);
+}
+
+int main(int argc, char** argv)
+{
+    static const char* screen_name[3] = {"bands", "gauge", "gray"};
+    unsigned char frame[512];
+    int cycles = (argc > 1) ? atoi(argv[1]) : 100;
+    unsigned long bytes, cs;
+    int s, f, x, level, frames, bad = 0;
+    LcdPerByte* lcd;
+    LcdPerByte* lcd_full;
+    GrayBench* gray;
+
+    lcd = new LcdPerByte(D11, D13, D12, D7, D10);
+    lcd_full = new LcdPerByte(D2, D3, D5, D6, D8);
+#if C12832_AUTO_UP
+    lcd_full->set_auto_up(0);
+#endif
+    gray = new GrayBench(*lcd);
+    srand(1);
+
+    printf("bench_gray : mean per frame of %d cycles\n", cycles);
+    printf("  %-13s %7s %9s %9s\n", "", "bytes", "CS cycles", "frames/s");
+    for(s = 0; s < 3; s++) {
+        gray->cls();
+        if(s == 0) {
+            for(x = 0; x < 4; x++) gray->fillrect(32 * x, 0, 32 * x + 31, 31, x);
+        } else if(s == 2) {
+            gray->fillrect(0, 0, 127, 31, 2);
+        }
+        gray->start();
+        bytes = 0;
+        cs = 0;
+        frames = 0;
+        for(f = 0; f < 3 * (cycles + 1); f++) {
+            if(s == 1) {
+                level = rand() % 128;
+                gray->fillrect(0, 24, 127, 31, 0);
+                gray->fillrect(0, 24, level, 31, 2);
+            }
+            host_clear();
+            gray->tick();
+            if(f >= 3) {
+                bytes += host_spi;
+                cs += host_edges[D10] / 2;
+                frames++;
+            }
+            lcd->frame_bytes(frame);
+            if(memcmp(frame, gray->get_plane(gray->shown()).data, 512) != 0) {
+                if(bad < 5) printf("%s, frame %d : the frame buffer is not the plane\n", screen_name[s], f);
+                bad++;
+            }
+        }
+        gray->stop();
+        line(screen_name[s], bytes, cs, frames);
+    }
+
+    bytes = 0;
+    cs = 0;
+    for(f = 0; f < cycles; f++) {
+        lcd_full->fillrect(rand() % 128, rand() % 32, rand() % 128, rand() % 32, f & 1);
+        lcd_full->invalidate();
+        host_clear();
+        lcd_full->copy_to_lcd();
+        bytes += host_spi;
+        cs += host_edges[D8] / 2;
+    }
+    line("copy_to_lcd", bytes, cs, cycles);
+
+    bytes = 0;
+    cs = 0;
+    for(f = 0; f < cycles; f++) {
+        host_clear();
+        lcd_full->copy_per_byte();
+        bytes += host_spi;
+        cs += host_edges[D8] / 2;
+    }
+    line("per byte", bytes, cs, cycles);
+    printf("bench_gray : bad %d\n", bad);
+    return bad != 0;
+}
@@ -0,0 +1,189 @@
+/* line() and circle() of the raster core against the per-pixel path
+ *
+ * LcdPerPixel keeps the old line() and circle(), Bresenham loops that
+ * set every pixel through pixel(). Two panels draw the same random
+ * lines and circles, one by the raster core (Raster.h), one by the old
+ * loops, for each draw mode and orientation. The frame buffers have to
+ * be the same, then both paths are timed in pixels per second. The
+ * numbers are from the host, only the ratio says something.
+ *
+ * usage : bench_pixel [shapes]
+ */
+
+#include "mbed.h"
+#include "C12832.h"
+
+class LcdPerPixel : public C12832
+{
+public:
+    LcdPerPixel(PinName mosi, PinName sck, PinName reset, PinName a0, PinName ncs)
+        : C12832(mosi, sck, reset, a0, ncs), pixels(0) {}
+
+    unsigned long pixels;   // pixel() calls of the old loops
+
+    void plot(int x, int y, int color)
+    {
+        pixels++;
+        pixel(x, y, color);
+    }
+
+    // line() as it was
+    void line_per_pixel(int x0, int y0, int x1, int y1, int color)
+    {
+        int dx, dy, dx_sym, dy_sym, dx_x2, dy_x2, di;
+
+        dx = x1 - x0;
+        dy = y1 - y0;
+        dx_sym = (dx > 0) ? 1 : -1;
+        dy_sym = (dy > 0) ? 1 : -1;
+        dx = dx_sym * dx;
+        dy = dy_sym * dy;
+        dx_x2 = dx * 2;
+        dy_x2 = dy * 2;
+        if(dx >= dy) {
+            di = dy_x2 - dx;
+            while(x0 != x1) {
+                plot(x0, y0, color);
+                x0 += dx_sym;
+                if(di < 0) {
+                    di += dy_x2;
+                } else {
+                    di += dy_x2 - dx_x2;
+                    y0 += dy_sym;
+                }
+            }
+            plot(x0, y0, color);
+        } else {
+            di = dx_x2 - dy;
+            while(y0 != y1) {
+                plot(x0, y0, color);
+                y0 += dy_sym;
+                if(di < 0) {
+                    di += dx_x2;
+                } else {
+                    di += dx_x2 - dy_x2;
+                    x0 += dx_sym;
+                }
+            }
+            plot(x0, y0, color);
+        }
+    }
+
+    // circle() as it was, the bounds checks left to pixel()
+    void circle_per_pixel(int x0, int y0, int r, int color)
+    {
+        int xx, yy, di;
+
+        if(r == 0) return;
+        plot(x0, y0 + r, color);
+        plot(x0, y0 - r, color);
+        plot(x0 + r, y0, color);
+        plot(x0 - r, y0, color);
+        if(r == 1) return;
+        di = 3 - 2 * r;
+        xx = 0;
+        yy = r;
+        while(xx < yy) {
+            if(di < 0) {
+                di += 4 * xx + 6;
+            } else {
+                di += 4 * (xx - yy) + 10;
+                yy--;
+            }
+            xx++;
+            plot(x0 + xx, y0 + yy, color);
+            plot(x0 - xx, y0 + yy, color);
+            plot(x0 + xx, y0 - yy, color);
+            plot(x0 - xx, y0 - yy, color);
+            plot(x0 + yy, y0 + xx, color);
+            plot(x0 - yy, y0 + xx, color);
+            plot(x0 + yy, y0 - xx, color);
+            plot(x0 - yy, y0 - xx, color);
+        }
+    }
+
+    void frame_bytes(unsigned char* out)
+    {
+        int k;
+
+        for(k = 0; k < 4; k++) {
+            memcpy(out + k * 128, ram_data(k, 0, 0, 128), 128);
+        }
+    }
+};
+
+struct Shape {
+    short a, b, c, d;
+};
+
+int main(int argc, char** argv)
+{
+    static const char* mode_name[3] = {"set", "clear", "xor"};
+    unsigned char fa[512], fb[512];
+    int shapes = (argc > 1) ? atoi(argv[1]) : 20000;
+    int o, m, kind, i, colour, bad = 0;
+    unsigned long pixels;
+    float t_new, t_old;
+    Shape* s = new Shape[shapes];
+    LcdPerPixel* lcd_new;
+    LcdPerPixel* lcd_old;
+    Timer t;
+
+    srand(1);
+    for(i = 0; i < shapes; i++) {
+        s[i].a = rand() % 160 - 16;
+        s[i].b = rand() % 160 - 16;
+        s[i].c = rand() % 160 - 16;
+        s[i].d = rand() % 160 - 16;
+    }
+    lcd_new = new LcdPerPixel(D11, D13, D12, D7, D10);
+    lcd_old = new LcdPerPixel(D2, D3, D5, D6, D8);
+#if C12832_AUTO_UP
+    lcd_new->set_auto_up(0);
+    lcd_old->set_auto_up(0);
+#endif
+
+    printf("bench_pixel : Mpixel/s, per pixel -> raster core\n");
+    for(kind = 0; kind < 2; kind++) {
+        for(o = 0; o < 4; o++) {
+            lcd_new->set_orientation(o);
+            lcd_old->set_orientation(o);
+            for(m = 0; m < 3; m++) {
+                lcd_new->setmode(m == 2 ? XOR : NORMAL);
+                lcd_old->setmode(m == 2 ? XOR : NORMAL);
+                colour = (m == 1) ? 0 : 1;
+                lcd_old->pixels = 0;
+
+                t.reset();
+                t.start();
+                for(i = 0; i < shapes; i++) {
+                    if(kind == 0) lcd_old->line_per_pixel(s[i].a, s[i].b % 48, s[i].c, s[i].d % 48, colour);
+                    else lcd_old->circle_per_pixel(s[i].a, s[i].b % 48, (s[i].c & 31) + 1, colour);
+                }
+                t.stop();
+                t_old = t.read();
+                pixels = lcd_old->pixels;
+
+                t.reset();
+                t.start();
+                for(i = 0; i < shapes; i++) {
+                    if(kind == 0) lcd_new->line(s[i].a, s[i].b % 48, s[i].c, s[i].d % 48, colour);
+                    else lcd_new->circle(s[i].a, s[i].b % 48, (s[i].c & 31) + 1, colour);
+                }
+                t.stop();
+                t_new = t.read();
+
+                lcd_new->frame_bytes(fa);
+                lcd_old->frame_bytes(fb);
+                if(memcmp(fa, fb, sizeof(fa)) != 0) {
+                    printf("%s, orientation %d, %s : frames differ\n", kind ? "circle" : "line", o, mode_name[m]);
+                    bad++;
+                }
+                printf("  %-6s orientation %d %-5s %7.1f -> %7.1f\n", kind ? "circle" : "line", o, mode_name[m],
+                       pixels / t_old / 1e6, pixels / t_new / 1e6);
+            }
+        }
+    }
+    printf("bench_pixel : bad %d\n", bad);
+    return bad != 0;
+}
@@ -0,0 +1,102 @@
+/* SPI traffic of a full frame, per byte against blocks
+ *
+ * The old copy_to_lcd() sent every command and data byte by wr_cmd() or
+ * wr_dat(), each with its own CS cycle. LcdPerByte does that again and is
+ * compared with copy_to_lcd(), which sends the address commands and the
+ * data of a page as two blocks with one CS cycle each. Both have to send
+ * the same data bytes.
+ *
+ * Counted are the level changes of the pins (DigitalOut writes), the
+ * bytes sent and the CS cycles. Build without TARGET_STM32F4, the blocks
+ * then go through SPI::write() too, see run.sh.
+ *
+ * usage : bench_spi [frames]
+ */
+
+#include "mbed.h"
+#include "C12832.h"
+
+// the update as it was : one CS cycle per byte
+class LcdPerByte : public C12832
+{
+public:
+    LcdPerByte(PinName mosi, PinName sck, PinName reset, PinName a0, PinName ncs)
+        : C12832(mosi, sck, reset, a0, ncs) {}
+
+    void copy_per_byte(void)
+    {
+        const unsigned char* data;
+        int page, i;
+
+        _dev->lock();
+        for(page = 0; page < 4; page++) {
+            wr_cmd(0x00);             // set column low nibble 0
+            wr_cmd(0x10);             // set column hi  nibble 0
+            wr_cmd(0xB0 | page);      // set page address
+            data = ram_data(page, 0, 0, 128);
+            for(i = 0; i < 128; i++) {
+                wr_dat(data[i]);
+            }
+        }
+        _dev->unlock();
+    }
+};
+
+// data bytes of the log, with CS low and A0 high
+static int take_data(PinName a0, PinName cs, unsigned char* out)
+{
+    int i, n = 0;
+
+    for(i = 0; i < host_nlog; i++) {
+        if((host_log[i].pins >> cs) & 1) continue;
+        if((host_log[i].pins >> a0) & 1) out[n++] = host_log[i].value;
+    }
+    return n;
+}
+
+int main(int argc, char** argv)
+{
+    static unsigned char data_old[HOST_LOG], data_new[HOST_LOG];
+    int frames = (argc > 1) ? atoi(argv[1]) : 100;
+    unsigned long gpio_old = 0, gpio_new = 0, spi_old = 0, spi_new = 0, cs_old = 0, cs_new = 0;
+    int f, n_old, n_new, bad = 0;
+    LcdPerByte* lcd;
+
+    lcd = new LcdPerByte(D11, D13, D12, D7, D10);
+#if C12832_AUTO_UP
+    lcd->set_auto_up(0);
+#endif
+    srand(1);
+    for(f = 0; f < frames; f++) {
+        lcd->fillrect(rand() % 128, rand() % 32, rand() % 128, rand() % 32, f & 1);
+        lcd->locate(rand() % 100, rand() % 24);
+        lcd->printf("%d", rand());
+
+        host_clear();
+        lcd->copy_per_byte();
+        gpio_old += host_gpio;
+        spi_old += host_spi;
+        cs_old += host_edges[D10] / 2;
+        n_old = take_data(D7, D10, data_old);
+
+        lcd->invalidate();
+        host_clear();
+        lcd->copy_to_lcd();
+        gpio_new += host_gpio;
+        spi_new += host_spi;
+        cs_new += host_edges[D10] / 2;
+        n_new = take_data(D7, D10, data_new);
+
+        if(n_old != n_new || memcmp(data_old, data_new, n_old) != 0) {
+            if(bad < 5) printf("frame %d : data differs, %d bytes per byte, %d bytes in blocks\n", f, n_old, n_new);
+            bad++;
+        }
+    }
+    printf("bench_spi : full frame, mean of %d\n", frames);
+    printf("  per byte : %4lu GPIO changes, %4lu bytes, %4lu CS cycles\n",
+           gpio_old / frames, spi_old / frames, cs_old / frames);
+    printf("  blocks   : %4lu GPIO changes, %4lu bytes, %4lu CS cycles\n",
+           gpio_new / frames, spi_new / frames, cs_new / frames);
+    printf("bench_spi : bad %d\n", bad);
+    return bad != 0;
+}
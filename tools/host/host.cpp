@@ -0,0 +1,132 @@
+/* host fake of the mbed 2 API used by the C12832 library, for the tests in tools/host
+ * see mbed.h
+ */
+
+#include "mbed.h"
+
+HostByte host_log[HOST_LOG];
+int host_nlog;
+uint32_t host_pins;
+unsigned long host_gpio;
+unsigned long host_edges[HOST_PINS];
+unsigned long host_spi;
+int host_isr;
+int host_irq_off;
+
+void host_clear(void)
+{
+    host_nlog = 0;
+    host_gpio = 0;
+    host_spi = 0;
+    memset(host_edges, 0, sizeof(host_edges));
+}
+
+void host_send(int value)
+{
+    host_spi++;
+    if(host_nlog >= HOST_LOG) return;
+    host_log[host_nlog].value = value;
+    host_log[host_nlog].pins = host_pins;
+    host_nlog++;
+}
+
+void host_set_pin(PinName pin, int value)
+{
+    uint32_t bit;
+
+    if(pin < 0 || pin >= HOST_PINS) return;
+    bit = 1UL << pin;
+    if(((host_pins & bit) != 0) == (value != 0)) return;
+    host_pins ^= bit;
+    host_gpio++;
+    host_edges[pin]++;
+}
+
+int host_get_pin(PinName pin)
+{
+    if(pin < 0 || pin >= HOST_PINS) return 0;
+    return (host_pins >> pin) & 1;
+}
+
+#if defined(TARGET_STM32F4)
+
+#include "PeripheralPins.h"
+
+SPI_TypeDef host_spi_regs[3] = {
+    {0, 0, SPI_SR_TXE, {}},
+    {0, 0, SPI_SR_TXE, {}},
+    {0, 0, SPI_SR_TXE, {}},
+};
+DMA_TypeDef host_dma_regs[2];
+DMA_Stream_TypeDef host_stream_regs[3];
+RCC_TypeDef host_rcc;
+
+const PinMap PinMap_SPI_MOSI[] = {
+    {D11, (uintptr_t)SPI1, 0},
+    {D4,  (uintptr_t)SPI3, 0},
+    {NC,  0, 0}
+};
+
+uintptr_t pinmap_peripheral(PinName pin, const PinMap* map)
+{
+    for(; map->pin != NC; map++) {
+        if(map->pin == pin) return map->peripheral;
+    }
+    return 0;
+}
+
+static uint32_t host_vector[64];
+static unsigned char host_irq_on[64];
+
+void NVIC_SetVector(IRQn_Type irq, uint32_t vector)
+{
+    host_vector[irq] = vector;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    host_irq_on[irq] = 1;
+}
+
+// the TX streams of the SPIs, like the library has them
+static const struct {
+    DMA_Stream_TypeDef* stream;
+    SPI_TypeDef* spi;
+    IRQn_Type irq;
+} host_tx[3] = {
+    {DMA2_Stream3, SPI1, DMA2_Stream3_IRQn},
+    {DMA1_Stream4, SPI2, DMA1_Stream4_IRQn},
+    {DMA1_Stream5, SPI3, DMA1_Stream5_IRQn},
+};
+
+int host_dma(void)
+{
+    const unsigned char* p;
+    DMA_Stream_TypeDef* s;
+    SPI_TypeDef* spi;
+    uint32_t i;
+    int k, more, done = 0;
+
+    do {
+        more = 0;
+        for(k = 0; k < 3; k++) {
+            s = host_tx[k].stream;
+            spi = host_tx[k].spi;
+            if(!(s->CR & DMA_SxCR_EN) || !(spi->CR2 & SPI_CR2_TXDMAEN)) continue;
+            p = (const unsigned char*)(uintptr_t)s->M0AR;
+            for(i = 0; i < s->NDTR; i++) spi->DR = p[i];
+            s->NDTR = 0;
+            s->CR &= ~DMA_SxCR_EN;
+            done++;
+            more = 1;
+            if((s->CR & DMA_SxCR_TCIE) && host_irq_on[host_tx[k].irq] && host_vector[host_tx[k].irq]) {
+                host_isr++;
+                ((void (*)(void))(uintptr_t)host_vector[host_tx[k].irq])();
+                host_isr--;
+            }
+        }
+    } while(more);
+    return done;
+}
+
+#endif
@@ -0,0 +1,397 @@
+/* host fake of the mbed 2 API used by the C12832 library, for the tests in tools/host
+ *
+ * The library is compiled for the host and runs against these classes.
+ * DigitalOut keeps the level of each pin and counts the changes, every
+ * byte sent by SPI::write is logged with the levels of all pins. So a
+ * test sees the command and data sequence of a panel (its A0 and CS
+ * pins) byte for byte.
+ *
+ * With TARGET_STM32F4 the SPI and DMA registers the library uses are
+ * variables. A byte written to an SPI DR is logged like SPI::write.
+ * host_dma() plays the DMA : the bytes of an enabled TX stream go to
+ * its SPI, then the transfer complete interrupt of the stream runs.
+ * The stream registers hold 32 bit addresses like on the target, the
+ * tests are linked with -no-pie so the buffers have such addresses.
+ *
+ * An interrupt is a function called by the test between host_isr++
+ * and host_isr--, core_util_is_isr_active() tells it the library.
+ */
+
+#ifndef HOST_MBED_H
+#define HOST_MBED_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+typedef enum {
+    NC = -1,
+    D0, D1, D2, D3, D4, D5, D6, D7, D8, D9, D10, D11, D12, D13, D14, D15,
+    A0, A1, A2, A3, A4, A5
+} PinName;
+
+#define HOST_PINS  22     // D0 .. A5
+#define HOST_LOG   65536  // bytes kept in the log
+
+// a byte sent on an SPI, pins : bit n = level of pin n when it was sent
+struct HostByte {
+    unsigned char value;
+    uint32_t pins;
+};
+
+extern HostByte host_log[HOST_LOG];
+extern int host_nlog;             // bytes in the log, more are counted in host_spi only
+extern uint32_t host_pins;        // level of the pins
+extern unsigned long host_gpio;   // level changes of DigitalOut
+extern unsigned long host_edges[HOST_PINS];   // level changes per pin
+extern unsigned long host_spi;    // bytes sent
+extern int host_isr;              // > 0 in an interrupt
+extern int host_irq_off;          // between __disable_irq and __enable_irq
+
+/** empty the log and set the counters to 0
+  *
+  */
+void host_clear(void);
+
+/** log a byte sent with the pins as they are now
+  *
+  */
+void host_send(int value);
+
+/** set a pin, a change is counted
+  *
+  */
+void host_set_pin(PinName pin, int value);
+
+/** level of a pin
+  *
+  */
+int host_get_pin(PinName pin);
+
+template <typename F> class Callback;
+
+template <> class Callback<void()>
+{
+public:
+    Callback() : _obj(NULL), _func(NULL), _thunk(NULL) {}
+
+    Callback(void (*func)()) : _obj(NULL), _func(func), _thunk(func ? call_func : NULL) {}
+
+    template <typename T, typename U> Callback(U* obj, void (T::*method)())
+        : _obj(static_cast<T*>(obj)), _func(NULL), _thunk(call_method<T>)
+    {
+        memcpy(_method, &method, sizeof(method));
+    }
+
+    void operator()() const
+    {
+        if(_thunk != NULL) _thunk(this);
+    }
+
+    operator bool() const
+    {
+        return _thunk != NULL;
+    }
+
+private:
+    static void call_func(const Callback* c)
+    {
+        c->_func();
+    }
+
+    template <typename T> static void call_method(const Callback* c)
+    {
+        void (T::*method)();
+
+        memcpy(&method, c->_method, sizeof(method));
+        (static_cast<T*>(c->_obj)->*method)();
+    }
+
+    void* _obj;
+    void (*_func)();
+    char _method[sizeof(void (Callback::*)())];   // same size for all classes without virtual bases
+    void (*_thunk)(const Callback*);
+};
+
+template <typename T, typename U> Callback<void()> callback(U* obj, void (T::*method)())
+{
+    return Callback<void()>(obj, method);
+}
+
+inline Callback<void()> callback(void (*func)())
+{
+    return Callback<void()>(func);
+}
+
+class DigitalOut
+{
+public:
+    DigitalOut(PinName pin, int value = 0) : _pin(pin)
+    {
+        host_set_pin(pin, value);
+    }
+    void write(int value)
+    {
+        host_set_pin(_pin, value);
+    }
+    int read()
+    {
+        return host_get_pin(_pin);
+    }
+    DigitalOut& operator=(int value)
+    {
+        write(value);
+        return *this;
+    }
+    operator int()
+    {
+        return read();
+    }
+private:
+    PinName _pin;
+};
+
+class SPI
+{
+public:
+    SPI(PinName mosi, PinName miso, PinName sclk, PinName ssel = NC) : _bits(8), _mode(0), _hz(1000000)
+    {
+        (void)mosi;
+        (void)miso;
+        (void)sclk;
+        (void)ssel;
+    }
+    void format(int bits, int mode = 0)
+    {
+        _bits = bits;
+        _mode = mode;
+    }
+    void frequency(int hz = 1000000)
+    {
+        _hz = hz;
+    }
+    int write(int value)
+    {
+        host_send(value);
+        return 0xFF;
+    }
+private:
+    int _bits, _mode, _hz;
+};
+
+// the test calls fire() as the interrupt of the ticker
+class Ticker
+{
+public:
+    Ticker() : _t(0) {}
+    virtual ~Ticker() {}
+    void attach(Callback<void()> func, float t)
+    {
+        _func = func;
+        _t = t;
+    }
+    void attach_us(Callback<void()> func, int t)
+    {
+        attach(func, t / 1000000.0f);
+    }
+    void detach()
+    {
+        _func = Callback<void()>();
+    }
+    bool attached()
+    {
+        return _func;
+    }
+    void fire()
+    {
+        host_isr++;
+        if(_func) _func();
+        host_isr--;
+    }
+private:
+    Callback<void()> _func;
+    float _t;
+};
+
+class Timer
+{
+public:
+    Timer() : _start(0), _time(0), _running(0) {}
+    void start()
+    {
+        if(_running) return;
+        _start = now();
+        _running = 1;
+    }
+    void stop()
+    {
+        if(!_running) return;
+        _time += now() - _start;
+        _running = 0;
+    }
+    void reset()
+    {
+        _start = now();
+        _time = 0;
+    }
+    float read()
+    {
+        return read_us() / 1000000.0f;
+    }
+    int read_ms()
+    {
+        return read_us() / 1000;
+    }
+    int read_us()
+    {
+        return (int)((_time + (_running ? now() - _start : 0)) / 1000);
+    }
+private:
+    static uint64_t now()
+    {
+        struct timespec t;
+
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+    }
+    uint64_t _start, _time;
+    int _running;
+};
+
+class Stream
+{
+public:
+    Stream(const char* name = NULL)
+    {
+        (void)name;
+    }
+    virtual ~Stream() {}
+    int putc(int c)
+    {
+        return _putc(c);
+    }
+    int getc()
+    {
+        return _getc();
+    }
+    int printf(const char* format, ...)
+    {
+        char buf[256];
+        va_list arg;
+        int i, n;
+
+        va_start(arg, format);
+        n = vsnprintf(buf, sizeof(buf), format, arg);
+        va_end(arg);
+        if(n > (int)sizeof(buf) - 1) n = sizeof(buf) - 1;
+        for(i = 0; i < n; i++) _putc(buf[i]);
+        return n;
+    }
+protected:
+    virtual int _putc(int c) = 0;
+    virtual int _getc() = 0;
+};
+
+inline void wait(float) {}
+inline void wait_ms(int) {}
+inline void wait_us(int) {}
+
+inline void __disable_irq(void)
+{
+    host_irq_off = 1;
+}
+
+inline void __enable_irq(void)
+{
+    host_irq_off = 0;
+}
+
+inline bool core_util_is_isr_active(void)
+{
+    return host_isr > 0;
+}
+
+#if defined(TARGET_STM32F4)
+
+// SPI data register, a write sends the byte
+struct HostDR {
+    HostDR& operator=(uint32_t value)
+    {
+        host_send(value & 0xFF);
+        return *this;
+    }
+    operator uint32_t() const
+    {
+        return 0xFF;
+    }
+};
+
+typedef struct {
+    volatile uint32_t CR1, CR2, SR;
+    HostDR DR;
+} SPI_TypeDef;
+
+typedef struct {
+    volatile uint32_t CR, NDTR, PAR, M0AR, M1AR, FCR;
+} DMA_Stream_TypeDef;
+
+typedef struct {
+    volatile uint32_t LISR, HISR, LIFCR, HIFCR;
+} DMA_TypeDef;
+
+typedef struct {
+    volatile uint32_t AHB1ENR;
+} RCC_TypeDef;
+
+typedef enum {
+    DMA1_Stream4_IRQn = 15,
+    DMA1_Stream5_IRQn = 16,
+    DMA2_Stream3_IRQn = 59
+} IRQn_Type;
+
+extern SPI_TypeDef host_spi_regs[3];
+extern DMA_TypeDef host_dma_regs[2];
+extern DMA_Stream_TypeDef host_stream_regs[3];   // DMA2 stream 3, DMA1 stream 4, DMA1 stream 5
+extern RCC_TypeDef host_rcc;
+
+#define SPI1          (&host_spi_regs[0])
+#define SPI2          (&host_spi_regs[1])
+#define SPI3          (&host_spi_regs[2])
+#define DMA1          (&host_dma_regs[0])
+#define DMA2          (&host_dma_regs[1])
+#define DMA2_Stream3  (&host_stream_regs[0])
+#define DMA1_Stream4  (&host_stream_regs[1])
+#define DMA1_Stream5  (&host_stream_regs[2])
+#define RCC           (&host_rcc)
+
+#define SPI_CR1_SPE          (1UL << 6)
+#define SPI_CR2_TXDMAEN      (1UL << 1)
+#define SPI_SR_TXE           (1UL << 1)
+#define SPI_SR_BSY           (1UL << 7)
+#define DMA_SxCR_EN          (1UL << 0)
+#define DMA_SxCR_TCIE        (1UL << 4)
+#define DMA_SxCR_DIR_0       (1UL << 6)
+#define DMA_SxCR_MINC        (1UL << 10)
+#define RCC_AHB1ENR_DMA1EN   (1UL << 21)
+#define RCC_AHB1ENR_DMA2EN   (1UL << 22)
+
+void NVIC_SetVector(IRQn_Type irq, uint32_t vector);
+void NVIC_EnableIRQ(IRQn_Type irq);
+
+/** run the enabled TX streams until none is left
+  *
+  * the bytes of a stream are sent on its SPI, then its interrupt is
+  * called if it is enabled, it may start the next transfer
+  *
+  * @returns transfers done
+  */
+int host_dma(void);
+
+#endif
+
+#endif
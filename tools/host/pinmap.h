@@ -0,0 +1,20 @@
+/* host fake of the mbed pin map, for the tests in tools/host
+ *
+ * The peripheral is an address like on the target, as wide as a pointer
+ * on the host.
+ */
+
+#ifndef HOST_PINMAP_H
+#define HOST_PINMAP_H
+
+#include "mbed.h"
+
+typedef struct {
+    PinName pin;
+    uintptr_t peripheral;
+    int function;
+} PinMap;
+
+uintptr_t pinmap_peripheral(PinName pin, const PinMap* map);
+
+#endif
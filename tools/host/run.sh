@@ -0,0 +1,78 @@
+#!/bin/sh
+# build and run the host tests and benchmarks of the C12832 library
+#
+# usage : tools/host/run.sh [name:defines ...]
+#
+#   tools/host/run.sh
+#   tools/host/run.sh "test_dma:-DTARGET_STM32F4 -DC12832_LAYERS=0"
+#
+# Each test is compiled from tools/host/<name>.cpp with the library in
+# C12832/ against the fake of mbed in tools/host (see mbed.h) and run.
+# A test prints what it checked or measured and returns 1 if a check
+# failed. The script fails if a test does not build, builds with
+# warnings or fails.
+#
+#   test_dma     flush_async() by DMA sends the bytes of copy_to_lcd()
+#   test_flush   flush_async() without DMA from an interrupt does not
+#                wait for the bus
+#   bench_spi    GPIO changes, bytes and CS cycles of a full frame,
+#                one CS cycle per byte against blocks
+#   test_glyph   character() draws like the old per-pixel path, glyphs/s
+#   bench_pixel  line() and circle() against the per-pixel path, pixels/s
+#                per draw mode and orientation
+#   bench_font   Small_7_page and Small_7_packed draw like Small_7,
+#                flash and glyphs/s of the three fonts
+#   bench_gray   bytes, CS cycles and frames/s of the GrayScale frames
+#                against full updates
+#
+# The numbers of the benchmarks are from the host, they show the
+# difference between two paths, not the speed on the target.
+# Set CXX to choose the compiler.
+
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+HOST=$ROOT/tools/host
+LIB=$ROOT/C12832
+CXX=${CXX:-g++}
+FLAGS="-std=c++98 -O2 -Wall -Wextra -no-pie"
+
+if [ $# -eq 0 ]; then
+    set -- "test_dma:-DTARGET_STM32F4" \
+        "test_dma:-DTARGET_STM32F4 -DC12832_SHADOW=1" \
+        "test_flush" \
+        "bench_spi" \
+        "test_glyph" \
+        "bench_pixel" \
+        "bench_font" \
+        "bench_gray"
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+fail=0
+for run in "$@"; do
+    name=${run%%:*}
+    defs=${run#*:}
+    [ "$defs" = "$run" ] && defs=""
+    printf "%s %s\n" "$name" "$defs"
+    if ! $CXX $FLAGS $defs -I"$HOST" -I"$LIB" "$LIB"/*.cpp "$HOST/host.cpp" "$HOST/$name.cpp" \
+            -o "$TMP/$name" 2> "$TMP/errors"; then
+        cat "$TMP/errors"
+        printf "%s does not build\n\n" "$name"
+        fail=1
+        continue
+    fi
+    if [ -s "$TMP/errors" ]; then
+        cat "$TMP/errors"
+        fail=1
+    fi
+    "$TMP/$name" || fail=1
+    printf "\n"
+done
+
+if [ $fail = 0 ]; then
+    printf "all passed\n"
+else
+    printf "FAILED\n"
+fi
+exit $fail
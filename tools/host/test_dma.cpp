@@ -0,0 +1,236 @@
+/* flush_async() by DMA against copy_to_lcd(), byte for byte
+ *
+ * Two panels get the same random drawing. lcd_dma is on SPI1 and is
+ * updated through the DMA of the fake, lcd_ref has no DMA and is updated
+ * by copy_to_lcd(). Each update has to send the same bytes with the
+ * same A0 on both, all with CS low. A flush_async() while a pass runs
+ * restarts the pass, that is checked on the screen lines of the
+ * controller RAM, rebuilt from the bytes of each panel.
+ *
+ * build with -DTARGET_STM32F4, see run.sh
+ *
+ * usage : test_dma [seed] [steps]
+ */
+
+#include "mbed.h"
+#include "C12832.h"
+
+#if !defined(TARGET_STM32F4)
+#error test_dma needs TARGET_STM32F4
+#endif
+
+// RAM of an ST7565R, made from the bytes sent to it
+struct Controller {
+    unsigned char ram[8][132];
+    int page, col, line, flip;
+
+    Controller() : page(0), col(0), line(0), flip(0)
+    {
+        memset(ram, 0, sizeof(ram));
+    }
+
+    // bytes of the log with CS low
+    void take(PinName a0, PinName cs)
+    {
+        int i, v;
+
+        for(i = 0; i < host_nlog; i++) {
+            if((host_log[i].pins >> cs) & 1) continue;
+            v = host_log[i].value;
+            if((host_log[i].pins >> a0) & 1) {
+                if(col < 132) ram[page][col] = v;
+                col++;
+            } else if((v & 0xF0) == 0xB0) {
+                page = v & 0x07;
+            } else if((v & 0xF0) == 0x10) {
+                col = (col & 0x0F) | ((v & 0x0F) << 4);
+            } else if((v & 0xF0) == 0x00) {
+                col = (col & 0xF0) | (v & 0x0F);
+            } else if((v & 0xC0) == 0x40) {
+                line = v & 0x3F;
+            } else if(v == 0xC0 || v == 0xC8) {
+                flip = (v == 0xC0);
+            }
+        }
+    }
+
+    // bit of RAM line n (0..63) in a column
+    int bit(int n, int c) const
+    {
+        return (ram[(n >> 3) & 7][c] >> (n & 7)) & 1;
+    }
+
+    // the 32 lines on the screen are the same, the other RAM lines hold
+    // what an earlier scroll left there and are not compared.
+    // The panel is on common 0..31, scanned from the other end it shows
+    // the 32 lines after the start line.
+    bool same_screen(const Controller& o) const
+    {
+        int n, c, first;
+
+        if(line != o.line || flip != o.flip) return false;
+        first = flip ? line + 32 : line;
+        for(n = 0; n < 32; n++) {
+            for(c = 0; c < 132; c++) {
+                if(bit(first + n, c) != o.bit(first + n, c)) return false;
+            }
+        }
+        return true;
+    }
+};
+
+// bytes of an update, A0 in bit 8
+static int take_update(PinName a0, PinName cs, int* out)
+{
+    int i, n = 0;
+
+    for(i = 0; i < host_nlog; i++) {
+        if((host_log[i].pins >> cs) & 1) continue;
+        out[n++] = host_log[i].value | (((host_log[i].pins >> a0) & 1) << 8);
+    }
+    return n;
+}
+
+static C12832* lcd_dma;
+static C12832* lcd_ref;
+static Controller ram_dma, ram_ref;
+static int done_count;
+
+static void done(void)
+{
+    done_count++;
+}
+
+// one random drawing operation on both panels, busy = a pass is running
+static void draw(int busy)
+{
+    int op, a, b, c, d, k;
+    C12832* lcd[2];
+
+    lcd[0] = lcd_dma;
+    lcd[1] = lcd_ref;
+    op = rand() % (busy ? 4 : 9);
+    a = rand() % 160 - 16;
+    b = rand() % 48 - 8;
+    c = rand() % 160 - 16;
+    d = rand() % 48 - 8;
+    for(k = 0; k < 2; k++) {
+        switch(op) {
+            case 0:
+                lcd[k]->line(a, b, c, d, 1);
+                break;
+            case 1:
+                lcd[k]->fillrect(a, b, c, d, c & 1);
+                break;
+            case 2:
+                lcd[k]->locate(a, b);
+                lcd[k]->printf("%d", c * d);
+                break;
+            case 3:
+                lcd[k]->pixel(a, b, d & 1);
+                break;
+            case 4:
+                lcd[k]->scroll(d % 12);
+                break;
+            case 5:
+                lcd[k]->setmode((a & 1) ? XOR : NORMAL);
+                break;
+            case 6:
+                lcd[k]->invalidate();
+                break;
+            case 7:
+                if(c % 8 == 0) lcd[k]->cls();
+                break;
+            case 8:
+                if(c % 16 == 0) lcd[k]->set_orientation(d & 3);
+                break;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    static int seq_dma[HOST_LOG], seq_ref[HOST_LOG];
+    int seed = (argc > 1) ? atoi(argv[1]) : 1;
+    int steps = (argc > 2) ? atoi(argv[2]) : 20000;
+    int step, n_dma, n_ref, done_before, bad = 0, passes = 0, restarts = 0, bytes = 0, irq_bad = 0;
+
+    srand(seed);
+    lcd_dma = new C12832(D11, D13, D12, D7, D10);   // SPI1, DMA2 stream 3
+    lcd_ref = new C12832(D2, D3, D5, D6, D8);       // no DMA
+#if C12832_AUTO_UP
+    lcd_dma->set_auto_up(0);
+    lcd_ref->set_auto_up(0);
+#endif
+    lcd_dma->attach_flush_done(callback(done));
+    host_clear();
+
+    for(step = 0; step < steps; step++) {
+        draw(0);
+        ram_dma.take(D7, D10);
+        ram_ref.take(D6, D8);
+        host_clear();
+
+        done_before = done_count;
+        if(rand() % 4 == 0) {
+            // a second flush_async() while the pass runs
+            lcd_dma->flush_async();
+            draw(1);
+            lcd_dma->flush_async();
+            host_dma();
+            ram_dma.take(D7, D10);
+            host_clear();
+            lcd_ref->copy_to_lcd();
+            ram_ref.take(D6, D8);
+            host_clear();
+            restarts++;
+#if C12832_SHADOW
+            // the shadows hold what each panel got and differ now,
+            // the next updates would send other runs
+            if(ram_dma.same_screen(ram_ref)) {
+                lcd_dma->invalidate();
+                lcd_ref->invalidate();
+                lcd_dma->flush_async();
+                host_dma();
+                ram_dma.take(D7, D10);
+                host_clear();
+                lcd_ref->copy_to_lcd();
+                ram_ref.take(D6, D8);
+                host_clear();
+            }
+#endif
+        } else {
+            lcd_dma->flush_async();
+            host_dma();
+            n_dma = take_update(D7, D10, seq_dma);
+            ram_dma.take(D7, D10);
+            host_clear();
+            lcd_ref->copy_to_lcd();
+            n_ref = take_update(D6, D8, seq_ref);
+            ram_ref.take(D6, D8);
+            host_clear();
+            if(n_dma != n_ref || memcmp(seq_dma, seq_ref, n_dma * sizeof(int)) != 0) {
+                if(bad < 5) printf("step %d : update differs, %d bytes by DMA, %d bytes by copy_to_lcd\n", step, n_dma, n_ref);
+                bad++;
+            }
+            bytes += n_dma;
+            passes++;
+        }
+        if(lcd_dma->busy() || done_count == done_before) {
+            if(bad < 5) printf("step %d : update not done\n", step);
+            bad++;
+        }
+        if(host_irq_off) irq_bad++;
+        if(!ram_dma.same_screen(ram_ref)) {
+            if(bad < 5) printf("step %d : screens of the controllers differ\n", step);
+            bad++;
+        }
+    }
+    if(irq_bad) {
+        printf("interrupts left off after %d steps\n", irq_bad);
+        bad++;
+    }
+    printf("test_dma : seed %d, %d updates equal byte for byte (%d bytes), %d restarted passes, bad %d\n",
+           seed, passes, bytes, restarts, bad);
+    return bad != 0;
+}
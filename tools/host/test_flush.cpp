@@ -0,0 +1,117 @@
+/* flush_async() without DMA from an interrupt
+ *
+ * The panel shares its bus with another device. A ticker interrupt
+ * calls flush_async() :
+ *   - bus free : the update is sent at once, in the interrupt
+ *   - bus held by the other device : flush_async() returns at once,
+ *     busy() is true and nothing is sent, the unlock() of the other
+ *     device sends the update
+ *   - a second call while it waits : both drawings go in one update
+ * Each update has to send the bytes copy_to_lcd() sends on a second
+ * panel with the same drawing.
+ *
+ * build without TARGET_STM32F4, see run.sh
+ *
+ * usage : test_flush [seed] [steps]
+ */
+
+#include "mbed.h"
+#include "C12832.h"
+
+#if defined(TARGET_STM32F4)
+#error test_flush is for the update without DMA
+#endif
+
+static C12832* lcd;
+static C12832* lcd_ref;
+static int done_count;
+
+static void done(void)
+{
+    done_count++;
+}
+
+static void flush_isr(void)
+{
+    lcd->flush_async();
+}
+
+// bytes of an update, A0 in bit 8
+static int take_update(PinName a0, PinName cs, int* out)
+{
+    int i, n = 0;
+
+    for(i = 0; i < host_nlog; i++) {
+        if((host_log[i].pins >> cs) & 1) continue;
+        out[n++] = host_log[i].value | (((host_log[i].pins >> a0) & 1) << 8);
+    }
+    return n;
+}
+
+static void draw(void)
+{
+    int x0 = rand() % 140 - 6, y0 = rand() % 40 - 4, x1 = rand() % 140 - 6, y1 = rand() % 40 - 4;
+
+    lcd->line(x0, y0, x1, y1, 1);
+    lcd_ref->line(x0, y0, x1, y1, 1);
+}
+
+int main(int argc, char** argv)
+{
+    static int seq[HOST_LOG], seq_ref[HOST_LOG];
+    int seed = (argc > 1) ? atoi(argv[1]) : 1;
+    int steps = (argc > 2) ? atoi(argv[2]) : 2000;
+    int step, kind, n, n_ref, done_before, bad = 0, held = 0;
+    SPIBus bus(D11, NC, D13);
+    SPIDevice other(bus, D9);
+    Ticker tick;
+
+    srand(seed);
+    lcd = new C12832(bus, D12, D7, D10);
+    lcd_ref = new C12832(D2, D3, D5, D6, D8);
+#if C12832_AUTO_UP
+    lcd->set_auto_up(0);
+    lcd_ref->set_auto_up(0);
+#endif
+    lcd->attach_flush_done(callback(done));
+    tick.attach(callback(flush_isr), 0.02f);
+
+    for(step = 0; step < steps; step++) {
+        draw();
+        host_clear();
+        done_before = done_count;
+        kind = rand() % 3;
+        if(kind == 0) {
+            tick.fire();              // bus free
+        } else {
+            other.lock();
+            tick.fire();
+            if(!lcd->busy() || done_count != done_before || host_nlog != 0) {
+                if(bad < 5) printf("step %d : update did not wait for the bus\n", step);
+                bad++;
+            }
+            if(kind == 2) {           // drawn and called again while it waits
+                draw();
+                tick.fire();
+            }
+            other.unlock();
+            held++;
+        }
+        if(lcd->busy() || done_count != done_before + 1 || host_irq_off || host_isr) {
+            if(bad < 5) printf("step %d : update not done\n", step);
+            bad++;
+        }
+        n = take_update(D7, D10, seq);
+        host_clear();
+        lcd_ref->copy_to_lcd();
+        n_ref = take_update(D6, D8, seq_ref);
+        host_clear();
+        if(n != n_ref || memcmp(seq, seq_ref, n * sizeof(int)) != 0) {
+            if(bad < 5) printf("step %d : update differs, %d bytes, %d bytes by copy_to_lcd\n", step, n, n_ref);
+            bad++;
+        }
+    }
+    printf("test_flush : seed %d, %d updates from an interrupt, %d while the bus was held, bad %d\n",
+           seed, steps, held, bad);
+    return bad != 0;
+}
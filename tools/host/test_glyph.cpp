@@ -0,0 +1,179 @@
+/* character() column by column against the old per-pixel path
+ *
+ * LcdPerPixel::character_per_pixel() is the old character() : the glyph
+ * of a GLCD Font Creator font goes pixel by pixel through pixel(). Two
+ * panels get the same random text, one by character(), one by the old
+ * path, at positions from above the top to below the bottom, in NORMAL
+ * and XOR mode and in all orientations. The frame buffers have to be
+ * the same after every char. The same again with a made up font of 16 x
+ * 32 pixels and 5 bytes per column, more than the 4 bytes of a column
+ * word, the fifth byte must not show.
+ *
+ * Then both paths draw the same text for the glyphs per second. The
+ * numbers are from the host, only the ratio says something.
+ *
+ * usage : test_glyph [seed] [chars]
+ */
+
+#include "mbed.h"
+#include "C12832.h"
+#include "Small_7.h"
+
+class LcdPerPixel : public C12832
+{
+public:
+    LcdPerPixel(PinName mosi, PinName sck, PinName reset, PinName a0, PinName ncs)
+        : C12832(mosi, sck, reset, a0, ncs) {}
+
+    // character() as it was, with its wrap of char_x and char_y
+    void character_per_pixel(int x, int y, int c)
+    {
+        unsigned int hor, vert, offset, bpl, j, i, b;
+        const unsigned char* zeichen;
+        unsigned char z, w;
+
+        if((c < 31) || (c > 127)) return;
+        offset = font[0];
+        hor = font[1];
+        vert = font[2];
+        bpl = font[3];
+        if((int)(char_x + hor) > width()) {
+            char_x = 0;
+            char_y = char_y + vert;
+            if(char_y >= height() - vert) {
+                char_y = 0;
+            }
+        }
+        zeichen = &font[((c - 32) * offset) + 4];
+        w = zeichen[0];
+        for(j = 0; j < vert; j++) {
+            for(i = 0; i < hor; i++) {
+                z = zeichen[bpl * i + ((j & 0xF8) >> 3) + 1];
+                b = 1 << (j & 0x07);
+                pixel(x + i, y + j, (z & b) ? 1 : 0);
+            }
+        }
+        char_x += w;
+    }
+
+    // the frame as the lcd would show it
+    void frame_bytes(unsigned char* out)
+    {
+        int k;
+
+        for(k = 0; k < 4; k++) {
+            memcpy(out + k * 128, ram_data(k, 0, 0, 128), 128);
+        }
+    }
+};
+
+// a GLCD font of random glyphs, 16 x 32 pixels, 5 bytes per column
+static unsigned char* make_tall_font(void)
+{
+    const int hor = 16, vert = 32, bpl = 5, offset = 1 + hor * bpl;
+    unsigned char* f = new unsigned char[4 + 96 * offset];
+    int c, i;
+
+    f[0] = offset;
+    f[1] = hor;
+    f[2] = vert;
+    f[3] = bpl;
+    for(c = 0; c < 96; c++) {
+        f[4 + c * offset] = 1 + rand() % hor;
+        for(i = 1; i < offset; i++) f[4 + c * offset + i] = rand();
+    }
+    return f;
+}
+
+// random chars of the current font on both panels, frames compared
+static int compare_chars(LcdPerPixel* lcd_new, LcdPerPixel* lcd_old, int chars, int* checked)
+{
+    unsigned char a[512], b[512];
+    int i, x, y, c, o, bad = 0;
+
+    for(o = 0; o < 4; o++) {
+        lcd_new->set_orientation(o);
+        lcd_old->set_orientation(o);
+        for(i = 0; i < chars / 8; i++) {
+            if(i % 64 == 0) {
+                lcd_new->setmode((i / 64) & 1 ? XOR : NORMAL);
+                lcd_old->setmode((i / 64) & 1 ? XOR : NORMAL);
+            }
+            x = rand() % (lcd_new->width() + 16) - 8;
+            y = rand() % (lcd_new->height() - 8 + 16) - 8;   // y from -8 to height - 1
+            c = 32 + rand() % 96;
+            lcd_new->character(x, y, c);
+            lcd_old->character_per_pixel(x, y, c);
+            lcd_new->frame_bytes(a);
+            lcd_old->frame_bytes(b);
+            (*checked)++;
+            if(memcmp(a, b, sizeof(a)) != 0) {
+                if(bad < 5) printf("orientation %d, char %d at %d,%d : frames differ\n", o, c, x, y);
+                bad++;
+                lcd_new->cls();
+                lcd_old->cls();
+            }
+        }
+    }
+    return bad;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned char a[512], b[512];
+    int seed = (argc > 1) ? atoi(argv[1]) : 1;
+    int chars = (argc > 2) ? atoi(argv[2]) : 200000;
+    int i, bad = 0, checked = 0;
+    unsigned char* tall;
+    float t_new, t_old;
+    LcdPerPixel* lcd_new;
+    LcdPerPixel* lcd_old;
+    Timer t;
+
+    srand(seed);
+    lcd_new = new LcdPerPixel(D11, D13, D12, D7, D10);
+    lcd_old = new LcdPerPixel(D2, D3, D5, D6, D8);
+#if C12832_AUTO_UP
+    lcd_new->set_auto_up(0);
+    lcd_old->set_auto_up(0);
+#endif
+    lcd_new->set_font((unsigned char*)Small_7);
+    lcd_old->set_font((unsigned char*)Small_7);
+
+    bad += compare_chars(lcd_new, lcd_old, chars, &checked);
+
+    tall = make_tall_font();
+    lcd_new->set_font(tall);
+    lcd_old->set_font(tall);
+    bad += compare_chars(lcd_new, lcd_old, chars / 4, &checked);
+    lcd_new->set_font((unsigned char*)Small_7);
+    lcd_old->set_font((unsigned char*)Small_7);
+    lcd_new->cls();
+    lcd_old->cls();
+
+    lcd_new->set_orientation(1);
+    lcd_old->set_orientation(1);
+    lcd_new->setmode(NORMAL);
+    lcd_old->setmode(NORMAL);
+    t.start();
+    for(i = 0; i < chars; i++) {
+        lcd_new->character((i * 7) % 120, (i * 5) % 32 - 4, 32 + i % 96);
+    }
+    t_new = t.read();
+    t.reset();
+    for(i = 0; i < chars; i++) {
+        lcd_old->character_per_pixel((i * 7) % 120, (i * 5) % 32 - 4, 32 + i % 96);
+    }
+    t_old = t.read();
+    lcd_new->frame_bytes(a);
+    lcd_old->frame_bytes(b);
+    if(memcmp(a, b, sizeof(a)) != 0) {
+        printf("frames differ after the timed run\n");
+        bad++;
+    }
+
+    printf("test_glyph : seed %d, %d chars equal pixel for pixel, bad %d\n", seed, checked, bad);
+    printf("  per pixel : %.2fM glyphs/s\n", chars / t_old / 1e6);
+    printf("  columns   : %.2fM glyphs/s\n", chars / t_new / 1e6);
+    return bad != 0;
+}
@@ -0,0 +1,153 @@
+/* declarations of the mbed 2 API used by the examples, for sizes.sh
+ *
+ * The objects made by sizes.sh are not linked into a program, the
+ * calls into mbed stay open. So only declarations are needed here,
+ * the sizes of the mbed library are not part of the report.
+ */
+
+#ifndef SIZES_MBED_H
+#define SIZES_MBED_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+typedef enum {
+    NC = -1,
+    D0, D1, D2, D3, D4, D5, D6, D7, D8, D9, D10, D11, D12, D13, D14, D15,
+    A0, A1, A2, A3, A4, A5
+} PinName;
+
+template <typename F> class Callback;
+
+template <> class Callback<void()>
+{
+public:
+    Callback();
+    Callback(void (*func)());
+    template <typename T, typename U> Callback(U* obj, void (T::*method)());
+    void operator()() const;
+    operator bool() const;
+private:
+    void* _obj;
+    void (*_thunk)(void*);
+};
+
+template <typename T, typename U> Callback<void()> callback(U* obj, void (T::*method)());
+Callback<void()> callback(void (*func)());
+
+class DigitalOut
+{
+public:
+    DigitalOut(PinName pin, int value = 0);
+    void write(int value);
+    int read();
+    DigitalOut& operator=(int value);
+    operator int();
+private:
+    int _pin;
+};
+
+class DigitalIn
+{
+public:
+    DigitalIn(PinName pin);
+    int read();
+    operator int();
+private:
+    int _pin;
+};
+
+class AnalogIn
+{
+public:
+    AnalogIn(PinName pin);
+    float read();
+    unsigned short read_u16();
+    operator float();
+private:
+    int _pin;
+};
+
+class InterruptIn
+{
+public:
+    InterruptIn(PinName pin);
+    void rise(Callback<void()> func);
+    void fall(Callback<void()> func);
+    int read();
+private:
+    int _pin;
+    Callback<void()> _rise, _fall;
+};
+
+class Ticker
+{
+public:
+    Ticker();
+    virtual ~Ticker();
+    void attach(Callback<void()> func, float t);
+    void attach_us(Callback<void()> func, int t);
+    void detach();
+private:
+    Callback<void()> _func;
+    uint64_t _delay;
+};
+
+class Timeout : public Ticker
+{
+};
+
+class Timer
+{
+public:
+    Timer();
+    void start();
+    void stop();
+    void reset();
+    float read();
+    int read_ms();
+    int read_us();
+private:
+    uint64_t _start, _time;
+    int _running;
+};
+
+class SPI
+{
+public:
+    SPI(PinName mosi, PinName miso, PinName sclk, PinName ssel = NC);
+    void format(int bits, int mode = 0);
+    void frequency(int hz = 1000000);
+    int write(int value);
+private:
+    int _spi;
+};
+
+class Stream
+{
+public:
+    Stream(const char* name = NULL);
+    virtual ~Stream();
+    int putc(int c);
+    int getc();
+    int printf(const char* format, ...);
+protected:
+    virtual int _putc(int c) = 0;
+    virtual int _getc() = 0;
+private:
+    FILE* _file;
+};
+
+void wait(float s);
+void wait_ms(int ms);
+void wait_us(int us);
+void __disable_irq(void);
+void __enable_irq(void);
+bool core_util_is_isr_active(void);
+
+#endif
@@ -0,0 +1,131 @@
+#!/bin/sh
+# flash and RAM of the C12832 / GraphicsDisplay / TextDisplay stack
+# for each example with some feature sets, see C12832/C12832_config.h
+#
+# usage : tools/sizes/sizes.sh [name:defines ...]
+#
+#   tools/sizes/sizes.sh
+#   tools/sizes/sizes.sh "nofont:-DC12832_FONT8X8=0" "noup:-DC12832_AUTO_UP=0"
+#
+# main.cpp of each example with a C12832 link and the shared C12832
+# folder are compiled with -ffunction-sections -fdata-sections and put
+# together with --gc-sections from main() on, like the mbed build does.
+# The sections of the library that are kept are counted :
+#
+#   flash  code, constants and vtables (.text .rodata .data)
+#   RAM    static data of the library (.data .bss) and one C12832 object,
+#          heap of layers, terminal and TextGrid not counted
+#
+# The mbed library is not compiled, tools/sizes/mbed.h declares the
+# parts the examples use. The DMA code of the STM32F4 is left out, it
+# is the same for all feature sets.
+# arm-none-eabi-g++ is used if found, else the g++ of the host. The host
+# numbers are larger (64 bit pointers, x86 code) but show the same
+# differences between the feature sets. Set CXX to choose the compiler.
+#
+# A feature set an example does not compile with is shown as -
+#
+# Everything is compiled with -Wall -Wextra. Warnings are listed at the
+# end and the script fails, so a report is also a check that the stack
+# builds clean with every feature set.
+#
+# The report is kept in tools/sizes/sizes.txt, made again after a change
+# of the library with
+#
+#   tools/sizes/sizes.sh > tools/sizes/sizes.txt
+
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+STUB=$ROOT/tools/sizes
+LIB=$ROOT/C12832
+
+if [ -z "$CXX" ]; then
+    if command -v arm-none-eabi-g++ > /dev/null 2>&1; then
+        CXX=arm-none-eabi-g++
+    else
+        CXX=g++
+    fi
+fi
+case $CXX in
+    *arm-none-eabi*) ARCH="-mcpu=cortex-m4 -mthumb -mfloat-abi=soft" ;;
+    *) ARCH="" ;;
+esac
+FLAGS="$ARCH -std=c++98 -Os -fno-rtti -fno-exceptions -fno-asynchronous-unwind-tables -ffunction-sections -fdata-sections -Wall -Wextra"
+
+if [ $# -eq 0 ]; then
+    set -- "all:" \
+        "shadow:-DC12832_SHADOW=1" \
+        "text:-DC12832_BITMAPS=0 -DC12832_SHAPES=0 -DC12832_PACKED_FONTS=0 -DC12832_STDIO=0" \
+        "min:-DC12832_BITMAPS=0 -DC12832_SHAPES=0 -DC12832_PACKED_FONTS=0 -DC12832_STDIO=0 -DC12832_LAYERS=0 -DC12832_TERMINAL=0"
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# sum of the sections of the objects in $TMP/lib that are kept
+lib_sizes()
+{
+    awk -v lib="$TMP/lib/" '
+        function hex(s,    i, n) {
+            n = 0
+            for (i = 3; i <= length(s); i++) n = n * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+            return n
+        }
+        /^Linker script and memory map/ { map = 1; next }
+        !map { next }
+        # a long section name is on its own line, the rest on the next
+        /^ \.[^ ]+$/ { name = $1; next }
+        /^ \.[^ ]+ +0x/ { name = $1; addr = 2 }
+        /^ +0x[0-9a-f]+ +0x[0-9a-f]+ / { if (name == "") next; addr = 1 }
+        addr {
+            obj = $(addr + 2)
+            size = hex($(addr + 1))
+            if (index(obj, lib) == 1 && size > 0) {
+                if (name ~ /^\.bss/ || name ~ /^COMMON/) ram += size
+                else if (name ~ /^\.data/ && name !~ /^\.data\.rel\.ro/) { flash += size; ram += size }
+                else if (name ~ /^\.(text|rodata|data\.rel\.ro)/) flash += size
+            }
+            name = ""; addr = 0
+        }
+        END { printf "%d %d\n", flash, ram }
+    ' "$TMP/map"
+}
+
+printf "compiler : %s\n" "$($CXX --version | head -n 1)"
+[ -z "$ARCH" ] && printf "           host compiler, not the target : compare the sets, not the bytes\n"
+printf "\n"
+printf "%-36s %-6s %8s %8s\n" "example" "set" "flash" "RAM"
+for main in "$ROOT"/*/main.cpp; do
+    dir=$(dirname "$main")
+    [ -d "$dir/C12832" ] || continue
+    for set in "$@"; do
+        name=${set%%:*}
+        defs=${set#*:}
+        rm -rf "$TMP/lib" && mkdir "$TMP/lib"
+        ok=1
+        for f in "$LIB"/*.cpp; do
+            $CXX $FLAGS $defs -I"$STUB" -I"$LIB" -c "$f" -o "$TMP/lib/$(basename "$f" .cpp).o" || ok=0
+        done
+        $CXX $FLAGS $defs -I"$STUB" -I"$LIB" -I"$dir" -c "$main" -o "$TMP/main.o" || ok=0
+        # one C12832 object, static or from new
+        printf '#include "C12832.h"\nchar c12832_object[sizeof(C12832)];\n' > "$TMP/object.cpp"
+        $CXX $FLAGS $defs -I"$STUB" -I"$LIB" -c "$TMP/object.cpp" -o "$TMP/object.o" || ok=0
+        if [ $ok = 1 ]; then
+            $CXX $ARCH -nostdlib -r -Wl,--gc-sections -Wl,-e,main -Wl,-Map,"$TMP/map" \
+                "$TMP/main.o" "$TMP"/lib/*.o -o "$TMP/app.o" || ok=0
+        fi
+        if [ $ok = 1 ]; then
+            sizes=$(lib_sizes)
+            object=$(nm -S "$TMP/object.o" | awk '/c12832_object/ { print $2 }')
+            [ "${sizes% *}" = 0 ] && object=0   # no display in this example
+            printf "%-36s %-6s %8d %8d\n" "$(basename "$dir")" "$name" "${sizes% *}" "$((${sizes#* } + 0x$object))"
+        else
+            printf "%-36s %-6s %8s %8s\n" "$(basename "$dir")" "$name" "-" "-"
+        fi
+    done
+done 2> "$TMP/errors"
+
+if grep -q "warning:" "$TMP/errors"; then
+    printf "\nwarnings :\n"
+    grep "warning:" "$TMP/errors" | sort -u
+    exit 1
+fi